@@ -21,6 +21,12 @@
 #include <QtCore/QStack>
 #include <QtCore/QVariant>
 
+#if QT_CONFIG(thread)
+#  include <QtCore/QList>
+#  include <QtCore/QRunnable>
+#  include <QtCore/QThreadPool>
+#endif
+
 // Helpers for QVariant conversion
 
 QMetaType QVariant_resolveMetaType(PyTypeObject *type)
@@ -344,3 +350,178 @@ PyObject *invokeMetaMethodWithReturn(const InvokeMetaMethodFuncWithReturn &f,
         return PyErr_Format(PyExc_RuntimeError, "QMetaMethod invocation failed.");
     return convertGenericReturnArgument(r.data(), r.metaType());
 }
+
+#if QT_CONFIG(thread)
+
+// Helpers for QThreadPool::startMany(), QThreadPool::map()
+
+namespace {
+
+// A Python call submitted to the thread pool and the concurrent.futures.Future
+// receiving its outcome (strong references).
+struct PyTask
+{
+    PyObject *callable = nullptr;
+    PyObject *argument = nullptr; // nullptr: Call without arguments
+    PyObject *future = nullptr;
+};
+
+void clearPyTask(PyTask &task)
+{
+    Py_CLEAR(task.callable);
+    Py_CLEAR(task.argument);
+    Py_CLEAR(task.future);
+}
+
+// Fetch and clear the current error as a normalized exception carrying
+// its traceback.
+PyObject *takePyException()
+{
+    PyObject *type{};
+    PyObject *value{};
+    PyObject *traceback{};
+    PyErr_Fetch(&type, &value, &traceback);
+    PyErr_NormalizeException(&type, &value, &traceback);
+    if (traceback != nullptr) {
+        PyException_SetTraceback(value, traceback);
+        Py_DECREF(traceback);
+    }
+    Py_XDECREF(type);
+    return value;
+}
+
+void runPyTask(const PyTask &task)
+{
+    static PyObject *const setRunningName =
+        Shiboken::String::createStaticString("set_running_or_notify_cancel");
+    static PyObject *const setResultName = Shiboken::String::createStaticString("set_result");
+    static PyObject *const setExceptionName = Shiboken::String::createStaticString("set_exception");
+
+    Shiboken::AutoDecRef running(PyObject_CallMethodObjArgs(task.future, setRunningName, nullptr));
+    if (running.isNull()) {
+        PyErr_WriteUnraisable(task.future);
+        return;
+    }
+    if (running.object() != Py_True) // Cancelled before it was picked up
+        return;
+
+    Shiboken::AutoDecRef result(PyObject_CallFunctionObjArgs(task.callable, task.argument,
+                                                             nullptr));
+    Shiboken::AutoDecRef exception(result.isNull() ? takePyException() : nullptr);
+    Shiboken::AutoDecRef ret(result.isNull()
+        ? PyObject_CallMethodObjArgs(task.future, setExceptionName, exception.object(), nullptr)
+        : PyObject_CallMethodObjArgs(task.future, setResultName, result.object(), nullptr));
+    if (ret.isNull())
+        PyErr_WriteUnraisable(task.future);
+}
+
+// Runs a chunk of tasks in one worker, acquiring the thread state once
+// instead of once per callable. On free-threaded builds, the chunks run
+// in parallel.
+class PyTaskChunk : public QRunnable
+{
+public:
+    Q_DISABLE_COPY_MOVE(PyTaskChunk)
+
+    explicit PyTaskChunk(QList<PyTask> &&tasks) noexcept : m_tasks(std::move(tasks)) {}
+    ~PyTaskChunk() override;
+
+    void run() override;
+
+private:
+    QList<PyTask> m_tasks;
+};
+
+PyTaskChunk::~PyTaskChunk()
+{
+    // Tasks left when the chunk was removed by QThreadPool::clear().
+    if (m_tasks.isEmpty() || Py_IsInitialized() == 0)
+        return;
+    static PyObject *const cancelName = Shiboken::String::createStaticString("cancel");
+    Shiboken::GilState state;
+    for (auto &task : m_tasks) {
+        Shiboken::AutoDecRef ret(PyObject_CallMethodObjArgs(task.future, cancelName, nullptr));
+        if (ret.isNull())
+            PyErr_WriteUnraisable(task.future);
+        clearPyTask(task);
+    }
+}
+
+void PyTaskChunk::run()
+{
+    Shiboken::GilState state;
+    for (auto &task : m_tasks) {
+        runPyTask(task);
+        clearPyTask(task);
+    }
+    m_tasks.clear();
+}
+
+} // namespace
+
+PyObject *qThreadPoolSubmit(QThreadPool *pool, PyObject *function, PyObject *iterable,
+                            int priority, int chunkSize)
+{
+    Shiboken::AutoDecRef items(PySequence_List(iterable));
+    if (items.isNull())
+        return nullptr;
+    const Py_ssize_t count = PyList_Size(items);
+    if (function == nullptr) {
+        for (Py_ssize_t i = 0; i < count; ++i) {
+            if (PyCallable_Check(PyList_GetItem(items, i)) == 0) {
+                return PyErr_Format(PyExc_TypeError, "startMany(): item %zd is not callable.",
+                                    i);
+            }
+        }
+    }
+
+    Shiboken::AutoDecRef futuresModule(PyImport_ImportModule("concurrent.futures"));
+    if (futuresModule.isNull())
+        return nullptr;
+    Shiboken::AutoDecRef futureType(PyObject_GetAttrString(futuresModule, "Future"));
+    if (futureType.isNull())
+        return nullptr;
+    Shiboken::AutoDecRef futures(PyList_New(count));
+    if (futures.isNull())
+        return nullptr;
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        PyObject *future = PyObject_CallObject(futureType, nullptr);
+        if (future == nullptr)
+            return nullptr;
+        PyList_SetItem(futures, i, future);
+    }
+
+    // Default to a few chunks per worker thread to balance uneven tasks.
+    if (chunkSize <= 0) {
+        const Py_ssize_t chunks = 4 * qMax(1, pool->maxThreadCount());
+        chunkSize = int(qMax(Py_ssize_t(1), (count + chunks - 1) / chunks));
+    }
+
+    QList<PyTaskChunk *> chunks;
+    chunks.reserve(count / chunkSize + 1);
+    for (Py_ssize_t start = 0; start < count; start += chunkSize) {
+        const Py_ssize_t end = qMin(count, start + chunkSize);
+        QList<PyTask> tasks;
+        tasks.reserve(end - start);
+        for (Py_ssize_t i = start; i < end; ++i) {
+            PyObject *item = PyList_GetItem(items, i);
+            PyTask task{function != nullptr ? function : item,
+                        function != nullptr ? item : nullptr,
+                        PyList_GetItem(futures, i)};
+            Py_INCREF(task.callable);
+            Py_XINCREF(task.argument);
+            Py_INCREF(task.future);
+            tasks.append(task);
+        }
+        chunks.append(new PyTaskChunk(std::move(tasks)));
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    for (auto *chunk : chunks)
+        pool->start(chunk, priority);
+    Py_END_ALLOW_THREADS
+
+    return futures.release();
+}
+
+#endif // QT_CONFIG(thread)
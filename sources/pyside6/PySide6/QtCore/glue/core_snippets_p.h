@@ -17,6 +17,7 @@ QT_FORWARD_DECLARE_CLASS(QGenericReturnArgument)
 QT_FORWARD_DECLARE_CLASS(QMetaType)
 QT_FORWARD_DECLARE_CLASS(QObject)
 QT_FORWARD_DECLARE_CLASS(QRegularExpression)
+QT_FORWARD_DECLARE_CLASS(QThreadPool)
 QT_FORWARD_DECLARE_CLASS(QVariant);
 
 QT_BEGIN_NAMESPACE
@@ -102,4 +103,12 @@ PyObject *invokeMetaMethodWithReturn(const InvokeMetaMethodFuncWithReturn &f,
                                      const QtCoreHelper::QGenericArgumentHolder &,
                                      const QtCoreHelper::QGenericArgumentHolder &);
 
+#if QT_CONFIG(thread)
+// Helpers for QThreadPool::startMany(), QThreadPool::map(): Submit the callables
+// (or function(item) for each item if function is given) in chunks and return
+// a list of concurrent.futures.Future.
+PyObject *qThreadPoolSubmit(QThreadPool *pool, PyObject *function, PyObject *iterable,
+                            int priority, int chunkSize);
+#endif
+
 #endif // CORE_SNIPPETS_P_H
@@ -9,31 +9,6 @@
 
 namespace QtDataVisualizationHelper {
 
-template <class T>
-static void populateArray(double xStart, double deltaX, double zStart, double deltaZ,
-                          qsizetype xSize, qsizetype zSize, qsizetype zStrideBytes,
-                          const T *data, QSurfaceDataArray *result)
-{
-    result->reserve(zSize);
-    const qsizetype zStride = zStrideBytes / sizeof(T);
-    double z = zStart;
-    for (qsizetype zi = 0; zi < zSize; ++zi) {
-        auto *row = new QSurfaceDataRow;
-        row->reserve(xSize);
-        result->append(row);
-
-        double x = xStart;
-        auto *rowDataEnd = data + xSize;
-        for (auto *d = data; d < rowDataEnd; ++d) {
-            row->append(QSurfaceDataItem(QVector3D(x, *d, z)));
-            x += deltaX;
-        }
-
-        data += zStride;
-        z += deltaZ;
-    }
-}
-
 QSurfaceDataArray *surfaceDataFromNp(double xStart, double deltaX, double zStart, double deltaZ,
                                      PyObject *pyData)
 {
@@ -41,13 +16,14 @@ QSurfaceDataArray *surfaceDataFromNp(double xStart, double deltaX, double zStart
 
     auto *result = new QSurfaceDataArray;
 
-    auto view = Shiboken::Numpy::View::fromPyObject(pyData);
+    auto view = Shiboken::Numpy::View::fromPyObjectStrided(pyData);
     if (!view) {
         PyErr_Format(PyExc_TypeError, "Invalid array passed to %s", funcName);
         return result;
     }
     if (view.ndim != 2) {
-        PyErr_Format(PyExc_TypeError, "%s expects a 2 dimensional array (%d)", view.ndim);
+        PyErr_Format(PyExc_TypeError, "%s expects a 2 dimensional array (%d)",
+                     funcName, view.ndim);
         return result;
     }
 
@@ -56,40 +32,30 @@ QSurfaceDataArray *surfaceDataFromNp(double xStart, double deltaX, double zStart
     if (zSize  == 0 || xSize == 0)
         return result;
 
-    switch (view.type) {
-    case Shiboken::Numpy::View::Int16:
-        populateArray(xStart, deltaX, zStart, deltaZ, xSize, zSize, view.stride[0],
-                      reinterpret_cast<const int16_t *>(view.data), result);
-        break;
-    case Shiboken::Numpy::View::Unsigned16:
-        populateArray(xStart, deltaX, zStart, deltaZ, xSize, zSize, view.stride[0],
-                      reinterpret_cast<const uint16_t *>(view.data), result);
-        break;
-    case Shiboken::Numpy::View::Int:
-        populateArray(xStart, deltaX, zStart, deltaZ, xSize, zSize, view.stride[0],
-                      reinterpret_cast<const int *>(view.data), result);
-        break;
-    case Shiboken::Numpy::View::Unsigned:
-        populateArray(xStart, deltaX, zStart, deltaZ, xSize, zSize, view.stride[0],
-                      reinterpret_cast<const unsigned *>(view.data), result);
-        break;
-    case Shiboken::Numpy::View::Int64:
-        populateArray(xStart, deltaX, zStart, deltaZ, xSize, zSize, view.stride[0],
-                      reinterpret_cast<const int64_t *>(view.data), result);
-        break;
-    case Shiboken::Numpy::View::Unsigned64:
-        populateArray(xStart, deltaX, zStart, deltaZ, xSize, zSize, view.stride[0],
-                      reinterpret_cast<const uint64_t *>(view.data), result);
-        break;
-    case Shiboken::Numpy::View::Float:
-        populateArray(xStart, deltaX, zStart, deltaZ, xSize, zSize, view.stride[0],
-                      reinterpret_cast<const float *>(view.data), result);
-        break;
-    case Shiboken::Numpy::View::Double:
-        populateArray(xStart, deltaX, zStart, deltaZ, xSize, zSize, view.stride[0],
-                      reinterpret_cast<const double *>(view.data), result);
+    // Convert the rows, which may be strided slices of any type, to float
+    Shiboken::Numpy::View rowView = view;
+    rowView.ndim = 1;
+    rowView.dimensions[0] = xSize;
+    rowView.stride[0] = view.stride[1];
+    QList<float> rowData(xSize);
+    result->reserve(zSize);
+    double z = zStart;
+    for (qsizetype zi = 0; zi < zSize; ++zi) {
+        rowView.data = static_cast<char *>(view.data) + zi * view.stride[0];
+        if (!rowView.copyTo(Shiboken::Numpy::View::Float, rowData.data(), sizeof(float))) {
+            PyErr_Format(PyExc_TypeError, "%s: Unsupported array type", funcName);
+            return result;
+        }
+        auto *row = new QSurfaceDataRow;
+        row->reserve(xSize);
+        result->append(row);
 
-        break;
+        double x = xStart;
+        for (float y : rowData) {
+            row->append(QSurfaceDataItem(QVector3D(x, y, z)));
+            x += deltaX;
+        }
+        z += deltaZ;
     }
     return result;
 }
@@ -14,3 +14,13 @@ const auto points = PySide::Numpy::xyDataToQPointFList(%PYARG_1, %PYARG_2);
 const auto points = PySide::Numpy::xyDataToQPointFList(%PYARG_1, %PYARG_2);
 %CPPSELF.replace(points);
 // @snippet qxyseries-replacenp-numpy-x-y
+
+// @snippet qxyseries-pointsnp
+%PYARG_0 = PySide::Numpy::qPointFListToArray(%CPPSELF.points());
+// @snippet qxyseries-pointsnp
+
+// @snippet qxyseries-replacenp-numpy-points
+const auto points = PySide::Numpy::pointDataToQPointFList(%PYARG_1);
+if (PyErr_Occurred() == nullptr)
+    %CPPSELF.replace(points);
+// @snippet qxyseries-replacenp-numpy-points
@@ -270,23 +270,9 @@ static QVariant QVariant_convertToVariantList(PyObject *list)
 
 using SpecificConverter = Shiboken::Conversions::SpecificConverter;
 
-static std::optional<SpecificConverter> converterForQtType(const char *typeNameC)
+static std::optional<SpecificConverter> converterForQtType(QMetaType metaType)
 {
-    // Fix typedef "QGenericMatrix<3,3,float>" -> QMatrix3x3". The reverse
-    // conversion happens automatically in QMetaType::fromName() in
-    // QVariant_resolveMetaType().
-    QByteArrayView typeNameV(typeNameC);
-    if (typeNameV.startsWith("QGenericMatrix<") && typeNameV.endsWith(",float>")) {
-        QByteArray typeName = typeNameV.toByteArray();
-        typeName.remove(1, 7);
-        typeName.remove(7, 1); // '<'
-        typeName.chop(7);
-        typeName.replace(',', 'x');
-        SpecificConverter matrixConverter(typeName.constData());
-        if (matrixConverter)
-            return matrixConverter;
-    }
-    SpecificConverter converter(typeNameC);
+    SpecificConverter converter(PySide::converterIdForMetaType(metaType));
     if (converter)
         return converter;
     return std::nullopt;
@@ -975,12 +961,29 @@ uchar *ptr = reinterpret_cast<uchar *>(Shiboken::Buffer::getPointer(%PYARG_1));
 // @snippet qfiledevice-map
 
 // @snippet qiodevice-bufferedread
-Py_ssize_t bufferLen;
-auto *data = reinterpret_cast<char*>(Shiboken::Buffer::getPointer(%PYARG_1, &bufferLen));
-%RETURN_TYPE %0 = %CPPSELF.%FUNCTION_NAME(data, PyLong_AsLongLong(%PYARG_2));
-return PyLong_FromLong(%0);
+Shiboken::Buffer::WritableBuffer buffer(%PYARG_1);
+if (!buffer.isValid())
+    return {};
+// Never write past the end of the buffer, whatever maxlen says.
+const qint64 maxlen = qMin(qint64(buffer.size()), qint64(%2));
+%RETURN_TYPE %0 = 0;
+Py_BEGIN_ALLOW_THREADS
+%0 = %CPPSELF.%FUNCTION_NAME(buffer.data(), maxlen);
+Py_END_ALLOW_THREADS
+return PyLong_FromLongLong(%0);
 // @snippet qiodevice-bufferedread
 
+// @snippet qiodevice-readinto
+Shiboken::Buffer::WritableBuffer buffer(%PYARG_1);
+if (!buffer.isValid())
+    return {};
+qint64 result = 0;
+Py_BEGIN_ALLOW_THREADS
+result = %CPPSELF.read(buffer.data(), buffer.size());
+Py_END_ALLOW_THREADS
+%PYARG_0 = %CONVERTTOPYTHON[qint64](result);
+// @snippet qiodevice-readinto
+
 // @snippet qiodevice-readdata
 QByteArray ba(1 + qsizetype(%2), char(0));
 %CPPSELF.%FUNCTION_NAME(ba.data(), qint64(%2));
@@ -1196,6 +1199,22 @@ if (result == -1) {
 }
 // @snippet qdatastream-readrawdata
 
+// @snippet qdatastream-readrawdata-pybuffer
+Shiboken::Buffer::WritableBuffer buffer(%PYARG_1);
+if (!buffer.isValid())
+    return {};
+qint64 r = 0;
+Py_BEGIN_ALLOW_THREADS
+r = %CPPSELF.%FUNCTION_NAME(buffer.data(), buffer.size());
+Py_END_ALLOW_THREADS
+if (r == -1) {
+    Py_INCREF(Py_None);
+    %PYARG_0 = Py_None;
+} else {
+    %PYARG_0 = %CONVERTTOPYTHON[qint64](r);
+}
+// @snippet qdatastream-readrawdata-pybuffer
+
 // @snippet qdatastream-writerawdata-pybuffer
 int r = 0;
 Py_ssize_t bufferLen;
@@ -1519,7 +1538,7 @@ const QMetaType metaType = QVariant_resolveMetaType(Py_TYPE(%in));
 bool ok = false;
 if (metaType.isValid()) {
     QVariant var(metaType);
-    auto converterO = converterForQtType(metaType.name());
+    auto converterO = converterForQtType(metaType);
     ok = converterO.has_value();
     if (ok) {
         converterO.value().toCpp(pyIn, var.data());
@@ -1690,7 +1709,7 @@ default:
     break;
 }
 
-auto converterO = converterForQtType(cppInRef.typeName());
+auto converterO = converterForQtType(cppInRef.metaType());
 if (converterO.has_value())
     return converterO.value().toPython(cppInRef.data());
 
@@ -1766,6 +1785,8 @@ auto cppCallback = [callable]()
     Shiboken::GilState state;
     Shiboken::AutoDecRef arglist(PyTuple_New(0));
     Shiboken::AutoDecRef ret(PyObject_CallObject(callable, arglist));
+    if (ret.isNull())
+        PyErr_Print();
     Py_DECREF(callable);
 };
 // @snippet std-function-void-lambda
@@ -1781,6 +1802,14 @@ Py_INCREF(callable);
 %PYARG_0 = %CONVERTTOPYTHON[int](cppResult);
 // @snippet qthreadpool-trystart
 
+// @snippet qthreadpool-startmany
+%PYARG_0 = qThreadPoolSubmit(%CPPSELF, nullptr, %PYARG_1, %2, %3);
+// @snippet qthreadpool-startmany
+
+// @snippet qthreadpool-map
+%PYARG_0 = qThreadPoolSubmit(%CPPSELF, %PYARG_1, %PYARG_2, %3, %4);
+// @snippet qthreadpool-map
+
 // @snippet repr-qevent
 QString result;
 QDebug(&result).nospace() << "<PySide6.QtCore.QEvent(" << %CPPSELF->type() << ")>";
@@ -1833,7 +1862,7 @@ switch (qArgData.metaType.id()) {
         *reinterpret_cast<QString *>(qArgData.data) = PySide::pyUnicodeToQString(%2);
         break;
     default: {
-        Shiboken::Conversions::SpecificConverter converter(qArgData.metaType.name());
+        Shiboken::Conversions::SpecificConverter converter(PySide::converterIdForMetaType(qArgData.metaType));
         const auto type = converter.conversionType();
         // Copy for values, Pointer for objects
         if (type == Shiboken::Conversions::SpecificConverter::InvalidConversion) {
@@ -1988,12 +2017,15 @@ const auto result = data.methodIndex != -1
 auto callable = %PYARG_1;
 auto callback = [callable]() -> void
 {
+    Shiboken::GilState state;
     if (!PyCallable_Check(callable)) {
         qWarning("Argument 1 of %FUNCTION_NAME must be a callable.");
+        Py_DECREF(callable);
         return;
     }
-    Shiboken::GilState state;
     Shiboken::AutoDecRef ret(PyObject_CallObject(callable, nullptr));
+    if (ret.isNull())
+        PyErr_Print();
     Py_DECREF(callable);
 };
 Py_INCREF(callable);
@@ -365,6 +365,16 @@ for (Py_ssize_t i = 0; i < count; ++i){
 %PYARG_0 = %CONVERTTOPYTHON[QPolygon *](%CPPSELF);
 // @snippet qpolygon-operatorlowerlower
 
+// @snippet qpolygonf-asnp
+%PYARG_0 = PySide::Numpy::qPointFListToArray(*%CPPSELF);
+// @snippet qpolygonf-asnp
+
+// @snippet qpolygonf-fromnp
+%RETURN_TYPE %0(PySide::Numpy::pointDataToQPointFList(%PYARG_1));
+if (PyErr_Occurred() == nullptr)
+    %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
+// @snippet qpolygonf-fromnp
+
 // @snippet qpixmap
 %0 = new %TYPE(QPixmap::fromImage(%1));
 // @snippet qpixmap
@@ -394,6 +404,130 @@ static void imageDecrefDataHandler(void *data)
 }
 // @snippet qimage-decref-image-data
 
+// @snippet qimage-bufferprotocol
+// Describe the pixels of an image as (height, width[, channels]) for formats
+// with byte-aligned components, and as rows of bytes otherwise. Note that
+// the 32bit formats (RGB32, ARGB32) are stored as BGRA on little endian.
+static Shiboken::Buffer::Layout qImageBufferLayout(const QImage &image)
+{
+    Shiboken::Buffer::Layout result;
+    result.shape[0] = image.height();
+    result.strides[0] = image.bytesPerLine();
+    Py_ssize_t channels = 1;
+    switch (image.format()) {
+    case QImage::Format_Alpha8:
+    case QImage::Format_Grayscale8:
+    case QImage::Format_Indexed8:
+        break;
+    case QImage::Format_Grayscale16:
+        result.itemSize = 2;
+        result.format = "H";
+        break;
+    case QImage::Format_RGB888:
+    case QImage::Format_BGR888:
+        channels = 3;
+        break;
+    case QImage::Format_RGB32:
+    case QImage::Format_ARGB32:
+    case QImage::Format_ARGB32_Premultiplied:
+    case QImage::Format_RGBX8888:
+    case QImage::Format_RGBA8888:
+    case QImage::Format_RGBA8888_Premultiplied:
+        channels = 4;
+        break;
+    case QImage::Format_RGBX64:
+    case QImage::Format_RGBA64:
+    case QImage::Format_RGBA64_Premultiplied:
+        channels = 4;
+        result.itemSize = 2;
+        result.format = "H";
+        break;
+    case QImage::Format_RGBX16FPx4:
+    case QImage::Format_RGBA16FPx4:
+    case QImage::Format_RGBA16FPx4_Premultiplied:
+        channels = 4;
+        result.itemSize = 2;
+        result.format = "e";
+        break;
+    case QImage::Format_RGBX32FPx4:
+    case QImage::Format_RGBA32FPx4:
+    case QImage::Format_RGBA32FPx4_Premultiplied:
+        channels = 4;
+        result.itemSize = 4;
+        result.format = "f";
+        break;
+    default:
+        result.ndim = 2;
+        result.shape[1] = image.bytesPerLine();
+        result.strides[1] = 1;
+        return result;
+    }
+    result.shape[1] = image.width();
+    result.strides[1] = channels * result.itemSize;
+    if (channels > 1) {
+        result.ndim = 3;
+        result.shape[2] = channels;
+        result.strides[2] = result.itemSize;
+    } else {
+        result.ndim = 2;
+    }
+    return result;
+}
+
+// Read-only buffers hold a shallow copy of the image, so that modifying the
+// image detaches it instead of changing or freeing the exported data.
+static const char imageCapsuleName[] = "QImage";
+
+static void imageCapsuleDestructor(PyObject *capsule)
+{
+    delete static_cast<QImage *>(PyCapsule_GetPointer(capsule, imageCapsuleName));
+}
+
+extern "C" {
+// QImage buffer protocol functions
+// see: http://www.python.org/dev/peps/pep-3118/
+
+static int SbkQImage_getbufferproc(PyObject *obj, Py_buffer *view, int flags)
+{
+    if (!view || !Shiboken::Object::isValid(obj))
+        return -1;
+
+    QImage * cppSelf = %CONVERTTOCPP[QImage *](obj);
+    const auto layout = qImageBufferLayout(*cppSelf);
+    // Detach only when write access is requested. The view holds a copy
+    // sharing the data, which keeps it alive when the image is changed
+    // or deleted while the buffer is exported.
+    const bool writable = (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE;
+    uchar *data = writable ? cppSelf->bits() : const_cast<uchar *>(cppSelf->constBits());
+    auto *copy = new QImage(*cppSelf);
+    PyObject *capsule = PyCapsule_New(copy, imageCapsuleName, imageCapsuleDestructor);
+    if (capsule == nullptr) {
+        delete copy;
+        return -1;
+    }
+    const auto mode = writable ? Shiboken::Buffer::ReadWrite : Shiboken::Buffer::ReadOnly;
+    const int result = Shiboken::Buffer::fillInfo(view, obj, data, layout, mode, flags, capsule);
+    Py_DECREF(capsule);
+    return result;
+}
+
+static void SbkQImage_releasebufferproc(PyObject *, Py_buffer *view)
+{
+    Shiboken::Buffer::releaseInfo(view);
+}
+
+static PyBufferProcs SbkQImageBufferProc = {
+    /*bf_getbuffer*/  (getbufferproc)SbkQImage_getbufferproc,
+    /*bf_releasebuffer*/ (releasebufferproc)SbkQImage_releasebufferproc,
+};
+
+}
+// @snippet qimage-bufferprotocol
+
+// @snippet qimage-bufferprotocol-init
+PepType_AS_BUFFER(Shiboken::SbkType<QImage>()) = &SbkQImageBufferProc;
+// @snippet qimage-bufferprotocol-init
+
 // @snippet qimage-constbits
 %PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.%FUNCTION_NAME(), %CPPSELF.sizeInBytes());
 // @snippet qimage-constbits
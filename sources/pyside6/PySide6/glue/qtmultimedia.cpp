@@ -22,6 +22,117 @@ const auto size = %CPPSELF.byteCount();
 %PYARG_0 = Shiboken::Buffer::newObject(data, size);
 // @snippet qaudiobuffer-const-data
 
+// @snippet qaudiobuffer-sampleview
+Shiboken::Buffer::Layout layout;
+const QAudioFormat format = %CPPSELF.format();
+switch (format.sampleFormat()) {
+case QAudioFormat::UInt8:
+    layout.format = "B";
+    break;
+case QAudioFormat::Int16:
+    layout.format = "h";
+    break;
+case QAudioFormat::Int32:
+    layout.format = "i";
+    break;
+case QAudioFormat::Float:
+    layout.format = "f";
+    break;
+default:
+    PyErr_SetString(PyExc_ValueError, "The sample format of the buffer is invalid.");
+    return {};
+}
+layout.ndim = 2;
+layout.itemSize = format.bytesPerSample();
+layout.shape[0] = %CPPSELF.frameCount();
+layout.shape[1] = format.channelCount();
+layout.strides[0] = format.bytesPerFrame();
+layout.strides[1] = layout.itemSize;
+%PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.data<unsigned char>(), layout,
+                                       Shiboken::Buffer::ReadWrite, %PYSELF);
+// @snippet qaudiobuffer-sampleview
+
+// @snippet qvideoframe-planeview
+// Describe the plane as (height, width, 4) for packed 32bit formats and as
+// rows of bytes (or 16bit values) otherwise.
+static Shiboken::Buffer::Layout qVideoFramePlaneLayout(const QVideoFrame &frame, int plane)
+{
+    Shiboken::Buffer::Layout result;
+    const Py_ssize_t bytesPerLine = frame.bytesPerLine(plane);
+    result.ndim = 2;
+    result.shape[0] = bytesPerLine > 0 ? frame.mappedBytes(plane) / bytesPerLine : 0;
+    result.strides[0] = bytesPerLine;
+    switch (frame.pixelFormat()) {
+    case QVideoFrameFormat::Format_ARGB8888:
+    case QVideoFrameFormat::Format_ARGB8888_Premultiplied:
+    case QVideoFrameFormat::Format_XRGB8888:
+    case QVideoFrameFormat::Format_BGRA8888:
+    case QVideoFrameFormat::Format_BGRA8888_Premultiplied:
+    case QVideoFrameFormat::Format_BGRX8888:
+    case QVideoFrameFormat::Format_ABGR8888:
+    case QVideoFrameFormat::Format_XBGR8888:
+    case QVideoFrameFormat::Format_RGBA8888:
+    case QVideoFrameFormat::Format_RGBX8888:
+    case QVideoFrameFormat::Format_AYUV:
+    case QVideoFrameFormat::Format_AYUV_Premultiplied:
+        result.ndim = 3;
+        result.shape[0] = frame.height();
+        result.shape[1] = frame.width();
+        result.shape[2] = 4;
+        result.strides[1] = 4;
+        result.strides[2] = 1;
+        return result;
+    case QVideoFrameFormat::Format_Y16:
+    case QVideoFrameFormat::Format_P010:
+    case QVideoFrameFormat::Format_P016:
+        result.itemSize = 2;
+        result.format = "H";
+        break;
+    default:
+        break;
+    }
+    result.shape[1] = bytesPerLine / result.itemSize;
+    result.strides[1] = result.itemSize;
+    return result;
+}
+
+// The memory view keeps a copy of the frame mapped while it exists
+static const char videoFrameCapsuleName[] = "QVideoFrame";
+
+static void videoFrameCapsuleDestructor(PyObject *capsule)
+{
+    auto *frame = static_cast<QVideoFrame *>(PyCapsule_GetPointer(capsule, videoFrameCapsuleName));
+    frame->unmap();
+    delete frame;
+}
+// @snippet qvideoframe-planeview
+
+// @snippet qvideoframe-planeview-function
+auto *frame = new QVideoFrame(*%CPPSELF);
+bool mapped{};
+%BEGIN_ALLOW_THREADS
+mapped = frame->map(%2);
+%END_ALLOW_THREADS
+if (!mapped || %1 < 0 || %1 >= frame->planeCount()) {
+    if (mapped)
+        frame->unmap();
+    delete frame;
+    PyErr_SetString(PyExc_RuntimeError, "Unable to map the video frame plane.");
+    return {};
+}
+Shiboken::AutoDecRef owner(PyCapsule_New(frame, videoFrameCapsuleName,
+                                         videoFrameCapsuleDestructor));
+if (owner.isNull()) {
+    frame->unmap();
+    delete frame;
+    return {};
+}
+const auto type = %2 == QVideoFrame::ReadOnly
+    ? Shiboken::Buffer::ReadOnly : Shiboken::Buffer::ReadWrite;
+%PYARG_0 = Shiboken::Buffer::newObject(frame->bits(%1), qVideoFramePlaneLayout(*frame, %1),
+                                       type, owner.object());
+// @snippet qvideoframe-planeview-function
+
 // @snippet qtaudio-namespace-compatibility-alias
 Py_INCREF(pyType);
 PyModule_AddObject(module, "QtAudio", reinterpret_cast<PyObject *>(pyType));
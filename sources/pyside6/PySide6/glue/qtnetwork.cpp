@@ -15,6 +15,22 @@ PyTuple_SetItem(%PYARG_0, 1, %CONVERTTOPYTHON[QHostAddress](ha));
 PyTuple_SetItem(%PYARG_0, 2, %CONVERTTOPYTHON[quint16](port));
 // @snippet qudpsocket-readdatagram
 
+// @snippet qudpsocket-readdatagram-pybuffer
+Shiboken::Buffer::WritableBuffer buffer(%PYARG_1);
+if (!buffer.isValid())
+    return {};
+QHostAddress ha;
+quint16 port = 0;
+qint64 retval = 0;
+Py_BEGIN_ALLOW_THREADS
+retval = %CPPSELF.%FUNCTION_NAME(buffer.data(), buffer.size(), &ha, &port);
+Py_END_ALLOW_THREADS
+%PYARG_0 = PyTuple_New(3);
+PyTuple_SetItem(%PYARG_0, 0, %CONVERTTOPYTHON[qint64](retval));
+PyTuple_SetItem(%PYARG_0, 1, %CONVERTTOPYTHON[QHostAddress](ha));
+PyTuple_SetItem(%PYARG_0, 2, %CONVERTTOPYTHON[quint16](port));
+// @snippet qudpsocket-readdatagram-pybuffer
+
 // @snippet qhostinfo-lookuphost-functor
 struct QHostInfoFunctor : public Shiboken::PyObjectHolder
 {
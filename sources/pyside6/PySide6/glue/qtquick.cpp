@@ -25,3 +25,44 @@ if (vertexCount != %1.size()) {
 QSGGeometry::Point2D *points = %CPPSELF->vertexDataAsPoint2D();
 std::copy(%1.cbegin(), %1.cend(), points);
 // @snippet qsgeometry-setvertexdataaspoint2d
+
+// @snippet qsgeometry-vertexdatanp
+// Expose the vertexes as rows of floats; attributes of other types can be
+// accessed using numpy.ndarray.view().
+const int vertexSize = %CPPSELF->sizeOfVertex();
+if (vertexSize % int(sizeof(float)) != 0) {
+    PyErr_Format(PyExc_TypeError, "Unsupported vertex size %d.", vertexSize);
+    return {};
+}
+Shiboken::Numpy::View view;
+view.ndim = 2;
+view.type = Shiboken::Numpy::View::Float;
+view.data = %CPPSELF->vertexData();
+view.dimensions[0] = %CPPSELF->vertexCount();
+view.dimensions[1] = vertexSize / int(sizeof(float));
+view.stride[0] = vertexSize;
+view.stride[1] = sizeof(float);
+%PYARG_0 = Shiboken::Numpy::createArrayView(view, %PYSELF);
+// @snippet qsgeometry-vertexdatanp
+
+// @snippet qsgeometry-indexdatanp
+Shiboken::Numpy::View view;
+switch (%CPPSELF->indexType()) {
+case QSGGeometry::UnsignedShortType:
+    view.type = Shiboken::Numpy::View::Unsigned16;
+    break;
+case QSGGeometry::UnsignedIntType:
+    view.type = Shiboken::Numpy::View::Unsigned;
+    break;
+default:
+    PyErr_SetString(PyExc_TypeError, "Unsupported index type.");
+    return {};
+}
+view.ndim = 1;
+view.data = %CPPSELF->indexData();
+view.dimensions[0] = %CPPSELF->indexCount();
+view.dimensions[1] = 0;
+view.stride[0] = %CPPSELF->sizeOfIndex();
+view.stride[1] = 0;
+%PYARG_0 = Shiboken::Numpy::createArrayView(view, %PYSELF);
+// @snippet qsgeometry-indexdatanp
@@ -183,17 +183,10 @@ inline PyObject *addMenuActionWithPyObject(QMenu *self, const QIcon &icon,
 // @snippet qwidget-addaction-4
 
 // @snippet qmenu-clear
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
 const auto &actions = %CPPSELF.actions();
-for (auto *act : actions) {
-    if (auto wrapper = bm.retrieveWrapper(act)) {
-        auto pyObj = reinterpret_cast<PyObject *>(wrapper);
-        Py_INCREF(pyObj);
-        Shiboken::Object::setParent(nullptr, pyObj);
-        Shiboken::Object::invalidate(pyObj);
-        Py_DECREF(pyObj);
-    }
-}
+Shiboken::Object::releaseChildren(reinterpret_cast<const void *const *>(actions.constData()),
+                                  std::size_t(actions.size()),
+                                  Shiboken::Object::InvalidateChildren);
 // @snippet qmenu-clear
 
 // @snippet qmenubar-clear
@@ -417,21 +410,15 @@ Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(%PYARG_0), "setWid
 
 // @snippet qgraphicsscene-clear
 const QList<QGraphicsItem *> items = %CPPSELF.items();
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
-for (auto *item : items) {
-    SbkObject *obj = bm.retrieveWrapper(item);
-    if (obj) {
-        if (Py_REFCNT(reinterpret_cast<PyObject *>(obj)) > 1) // If the refcnt is 1 the object will vannish anyway.
-            Shiboken::Object::invalidate(obj);
-        Shiboken::Object::removeParent(obj);
-    }
-}
+// If the refcnt is 1 the object will vannish anyway.
+Shiboken::Object::releaseChildren(reinterpret_cast<const void *const *>(items.constData()),
+                                  std::size_t(items.size()),
+                                  Shiboken::Object::InvalidateReferencedChildren);
 %CPPSELF.%FUNCTION_NAME();
 // @snippet qgraphicsscene-clear
 
 // @snippet qtreewidget-clear
 QTreeWidgetItem *rootItem = %CPPSELF.invisibleRootItem();
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
 
 // PYSIDE-1251:
 // Since some objects can be created with a parent and without
@@ -439,12 +426,12 @@ Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
 // deleted when setting the parent to nullptr, so we change the loop
 // to do this from the last child to the first, to avoid the case
 // when the child(1) points to the original child(2) in case the
-// first one was removed.
-for (int i = rootItem->childCount() - 1; i >= 0; --i) {
-    QTreeWidgetItem *item = rootItem->child(i);
-    if (SbkObject *wrapper = bm.retrieveWrapper(item))
-        Shiboken::Object::setParent(nullptr, reinterpret_cast<PyObject *>(wrapper));
-}
+// first one was removed. Collect the items before releasing them.
+QList<const void *> items;
+items.reserve(rootItem->childCount());
+for (int i = rootItem->childCount() - 1; i >= 0; --i)
+    items.append(rootItem->child(i));
+Shiboken::Object::releaseChildren(items.constData(), std::size_t(items.size()));
 // @snippet qtreewidget-clear
 
 // @snippet qtreewidgetitem
@@ -455,17 +442,12 @@ if (%0)
 // @snippet qtreewidgetitem
 
 // @snippet qlistwidget-clear
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
-for (int i = 0, count = %CPPSELF.count(); i < count; ++i) {
-    QListWidgetItem *item = %CPPSELF.item(i);
-    if (auto wrapper = bm.retrieveWrapper(item)) {
-        auto pyObj = reinterpret_cast<PyObject *>(wrapper);
-        Py_INCREF(pyObj);
-        Shiboken::Object::setParent(nullptr, pyObj);
-        Shiboken::Object::invalidate(pyObj);
-        Py_DECREF(pyObj);
-    }
-}
+QList<const void *> items;
+items.reserve(%CPPSELF.count());
+for (int i = 0, count = %CPPSELF.count(); i < count; ++i)
+    items.append(%CPPSELF.item(i));
+Shiboken::Object::releaseChildren(items.constData(), std::size_t(items.size()),
+                                  Shiboken::Object::InvalidateChildren);
 %CPPSELF.%FUNCTION_NAME();
 // @snippet qlistwidget-clear
 
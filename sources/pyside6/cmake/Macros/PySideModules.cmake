@@ -239,6 +239,12 @@ macro(create_pyside_module)
         list(APPEND shiboken_command "--framework-include-paths=${shiboken_framework_include_dirs}")
     endif()
 
+    if(PYSIDE_PRECOMPILED_HEADER)
+        list(APPEND shiboken_command
+            "--precompiled-header=${pyside6_BINARY_DIR}/pyside6_pch.h"
+            "--precompiled-header-directory=${pyside6_BINARY_DIR}/pch")
+    endif()
+
     if(${module_DROPPED_ENTRIES})
         list(JOIN ${module_DROPPED_ENTRIES} "\;" dropped_entries)
         list(APPEND shiboken_command "\"--drop-type-entries=${dropped_entries}\"")
@@ -103,6 +103,7 @@ add_definitions(${Qt${QT_MAJOR_VERSION}Core_DEFINITIONS})
 
 option(BUILD_TESTS "Build tests." TRUE)
 option(ENABLE_VERSION_SUFFIX "Used to use current version in suffix to generated files. This is used to allow multiples versions installed simultaneous." FALSE)
+option(PYSIDE_PRECOMPILED_HEADER "Let shiboken precompile the QtCore headers once for all modules." TRUE)
 set(LIB_SUFFIX "" CACHE STRING "Define suffix of directory name (32/64)" )
 set(LIB_INSTALL_DIR "lib${LIB_SUFFIX}" CACHE PATH "The subdirectory relative to the install prefix where libraries will be installed (default is /lib${LIB_SUFFIX})" FORCE)
 if(CMAKE_HOST_APPLE)
@@ -116,6 +116,11 @@ PyTypeObject *PyClassProperty_TypeF()
     return type;
 }
 
+// The tp_setattro of the shiboken meta type replaced by init(). It invalidates
+// the caches of libshiboken depending on the type attributes (overrides of
+// virtual methods, overload decisions) before calling the one of PyType_Type.
+static setattrofunc SbkObjectType_base_setattro = nullptr;
+
 /*
  * Types with class properties need to handle `Type.class_prop = x` in a specific way.
  * By default, Python replaces the `class_property` itself, but for wrapped C++ types
@@ -141,7 +146,7 @@ static int SbkObjectType_meta_setattro(PyObject *obj, PyObject *name, PyObject *
         // Call `class_property.__set__()` instead of replacing the `class_property`.
         return PepExt_Type_GetDescrSetSlot(Py_TYPE(descr))(descr, obj, value);
     } // Replace existing attribute.
-    return PepExt_Type_GetSetAttroSlot(&PyType_Type)(obj, name, value);
+    return SbkObjectType_base_setattro(obj, name, value);
 }
 
 } // extern "C"
@@ -165,7 +170,10 @@ static const char *PyClassProperty_SignatureStrings[] = {
 void init(PyObject *module)
 {
     PyTypeObject *type = SbkObjectType_TypeF();
-    type->tp_setattro = SbkObjectType_meta_setattro;
+    if (type->tp_setattro != SbkObjectType_meta_setattro) {
+        SbkObjectType_base_setattro = type->tp_setattro;
+        type->tp_setattro = SbkObjectType_meta_setattro;
+    }
 
     if (InitSignatureStrings(PyClassProperty_TypeF(), PyClassProperty_SignatureStrings) < 0)
         return;
@@ -12,6 +12,7 @@
 #include "pysideqenum.h"
 #include "pyside_p.h"
 #include "pysidestaticstrings.h"
+#include "signalmanager_p.h"
 
 #include <shiboken.h>
 
@@ -117,8 +118,10 @@ MetaObjectBuilder::MetaObjectBuilder(PyTypeObject *type, const QMetaObject *meta
 
 MetaObjectBuilder::~MetaObjectBuilder()
 {
-    for (const auto *metaObject : m_d->m_cachedMetaObjects)
+    for (const auto *metaObject : m_d->m_cachedMetaObjects) {
+        PySide::clearMetaCallConverters(metaObject);
         free(const_cast<QMetaObject*>(metaObject));
+    }
     delete m_d->m_builder;
     delete m_d;
 }
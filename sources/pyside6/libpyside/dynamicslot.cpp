@@ -6,6 +6,7 @@
 #include "pysideutils.h"
 #include "pysideweakref.h"
 #include "signalmanager.h"
+#include "signalmanager_p.h"
 
 #include <autodecref.h>
 #include <gilstate.h>
@@ -15,7 +16,12 @@
 #include <QtCore/QtCompare>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
 #include <QtCore/QPointer>
+#include <QtCore/QSet>
+
+#include <optional>
 
 namespace PySide
 {
@@ -41,8 +47,7 @@ public:
     explicit CallbackDynamicSlot(PyObject *callback) noexcept;
     ~CallbackDynamicSlot() override;
 
-    void call(const QByteArrayList &parameterTypes, const char *returnType,
-              void **cppArgs) override;
+    void call(MetaCallConverters &converters, void **cppArgs) override;
     void formatDebug(QDebug &debug) const override;
 
 private:
@@ -61,10 +66,9 @@ CallbackDynamicSlot::~CallbackDynamicSlot()
     Py_DECREF(m_callback);
 }
 
-void CallbackDynamicSlot::call(const QByteArrayList &parameterTypes, const char *returnType,
-                               void **cppArgs)
+void CallbackDynamicSlot::call(MetaCallConverters &converters, void **cppArgs)
 {
-    SignalManager::callPythonMetaMethod(parameterTypes, returnType, cppArgs, m_callback);
+    callPythonMetaMethod(converters, cppArgs, m_callback);
     // SignalManager::callPythonMetaMethod might have failed, in that case we have to print the
     // error so it considered "handled".
     if (PyErr_Occurred() != nullptr)
@@ -91,8 +95,7 @@ public:
 
     PyObject *pythonSelf() const { return m_pythonSelf; }
 
-    void call(const QByteArrayList &parameterTypes, const char *returnType,
-              void **cppArgs) override;
+    void call(MetaCallConverters &converters, void **cppArgs) override;
     void formatDebug(QDebug &debug) const override;
 
 private:
@@ -112,14 +115,12 @@ MethodDynamicSlot::~MethodDynamicSlot()
     Py_DECREF(m_function);
 }
 
-void MethodDynamicSlot::call(const QByteArrayList &parameterTypes, const char *returnType,
-                             void **cppArgs)
+void MethodDynamicSlot::call(MetaCallConverters &converters, void **cppArgs)
 {
     // create a callback based on method data
     Shiboken::AutoDecRef callable(PepExt_Type_CallDescrGet(m_function,
                                                            m_pythonSelf, nullptr));
-    SignalManager::callPythonMetaMethod(parameterTypes, returnType,
-                                        cppArgs, callable.object());
+    callPythonMetaMethod(converters, cppArgs, callable.object());
     // SignalManager::callPythonMetaMethod might have failed, in that case we have to print the
     // error so it considered "handled".
     if (PyErr_Occurred() != nullptr)
@@ -235,7 +236,7 @@ QDebug operator<<(QDebug debug, const DynamicSlot *ds)
 // aggregating DynamicSlot), which is passed to:
 // QObjectPrivate::connect(const QObject *, int signal, QtPrivate::QSlotObjectBase *, ...).
 // For each of those connections (identified by ConnectionKey), we maintain a
-// hash of ConnectionKey->QMetaObject::Connection for:
+// hash of ConnectionKey->QMetaObject::Connection (ConnectionRegistry) for:
 //
 // - Disconnecting: Retrieve QMetaObject::Connection for the connection parameters
 //
@@ -299,9 +300,109 @@ QDebug operator<<(QDebug debug, const QMetaObject::Connection &c)
     return debug;
 }
 
-using ConnectionHash = QHash<ConnectionKey, QMetaObject::Connection>;
+// Hash of the connections with secondary indexes by sender and receiver
+// object, so that the connections affected by the deletion of a sender or
+// receiver can be found without iterating over all connections. It is
+// accessed from the threads establishing connections.
+class ConnectionRegistry
+{
+public:
+    using Connections = QList<QMetaObject::Connection>;
+
+    void insert(const ConnectionKey &key, const QMetaObject::Connection &connection);
+    std::optional<QMetaObject::Connection> take(const ConnectionKey &key);
+    void removeSender(const QObject *sender);
+    Connections takeReceiver(const PyObject *object);
+    void clear();
+
+private:
+    using KeySet = QSet<ConnectionKey>;
+
+    void removeFromIndexes(const ConnectionKey &key);
+
+    QHash<ConnectionKey, QMetaObject::Connection> m_connections;
+    QHash<const QObject *, KeySet> m_senderIndex;
+    QHash<const PyObject *, KeySet> m_receiverIndex;
+    QMutex m_mutex;
+};
+
+template <class Index, class IndexKey>
+static void removeFromIndex(Index &index, const IndexKey &indexKey, const ConnectionKey &key)
+{
+    auto it = index.find(indexKey);
+    if (it != index.end()) {
+        it.value().remove(key);
+        if (it.value().isEmpty())
+            index.erase(it);
+    }
+}
+
+void ConnectionRegistry::removeFromIndexes(const ConnectionKey &key)
+{
+    removeFromIndex(m_senderIndex, key.sender, key);
+    if (key.object != nullptr)
+        removeFromIndex(m_receiverIndex, key.object, key);
+}
+
+void ConnectionRegistry::insert(const ConnectionKey &key,
+                                const QMetaObject::Connection &connection)
+{
+    QMutexLocker locker(&m_mutex);
+    m_connections.insert(key, connection);
+    m_senderIndex[key.sender].insert(key);
+    if (key.object != nullptr)
+        m_receiverIndex[key.object].insert(key);
+}
+
+std::optional<QMetaObject::Connection> ConnectionRegistry::take(const ConnectionKey &key)
+{
+    QMutexLocker locker(&m_mutex);
+    auto it = m_connections.find(key);
+    if (it == m_connections.end())
+        return std::nullopt;
+    const QMetaObject::Connection result = it.value();
+    m_connections.erase(it);
+    removeFromIndexes(key);
+    return result;
+}
 
-static ConnectionHash connectionHash;
+void ConnectionRegistry::removeSender(const QObject *sender)
+{
+    QMutexLocker locker(&m_mutex);
+    const KeySet keys = m_senderIndex.take(sender);
+    for (const auto &key : keys) {
+        m_connections.remove(key);
+        if (key.object != nullptr)
+            removeFromIndex(m_receiverIndex, key.object, key);
+    }
+}
+
+ConnectionRegistry::Connections ConnectionRegistry::takeReceiver(const PyObject *object)
+{
+    Connections result;
+    QMutexLocker locker(&m_mutex);
+    const KeySet keys = m_receiverIndex.take(object);
+    result.reserve(keys.size());
+    for (const auto &key : keys) {
+        auto it = m_connections.find(key);
+        if (it != m_connections.end()) {
+            result.append(it.value());
+            m_connections.erase(it);
+        }
+        removeFromIndex(m_senderIndex, key.sender, key);
+    }
+    return result;
+}
+
+void ConnectionRegistry::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_connections.clear();
+    m_senderIndex.clear();
+    m_receiverIndex.clear();
+}
+
+static ConnectionRegistry connectionRegistry;
 
 static ConnectionKey connectionKey(const QObject *sender, int senderIndex,
                                    PyObject *callback)
@@ -348,53 +449,41 @@ public Q_SLOTS:
 
 void SenderSignalDeletionTracker::senderDestroyed(QObject *o)
 {
-    for (auto it = connectionHash.begin(); it != connectionHash.end(); ) {
-        if (it.key().sender == o)
-            it = connectionHash.erase(it);
-        else
-            ++it;
-    }
+    connectionRegistry.removeSender(o);
 }
 
 static QPointer<SenderSignalDeletionTracker> senderSignalDeletionTracker;
+static QMutex senderSignalDeletionTrackerMutex;
 
 static void disconnectReceiver(PyObject *pythonSelf)
 {
     // A check for reentrancy was added for PYSIDE-88, but has not been
-    // observed yet.
-    for (bool keepGoing = true; keepGoing; ) {
-        keepGoing = false;
-        for (auto it = connectionHash.begin(); it != connectionHash.end(); ) {
-            if (it.key().object == pythonSelf) {
-                const auto oldSize = connectionHash.size();
-                QObject::disconnect(it.value());
-                it = connectionHash.erase(it);
-                // Check for a disconnection causing deletion of further objects
-                // by a re-entrant call.
-                if (connectionHash.size() < oldSize - 1) {
-                    keepGoing = true;
-                    break; // Iterators were invalidated, retry
-                }
-            } else {
-                ++it;
-            }
-        }
+    // observed yet. The connections are taken out of the registry before
+    // disconnecting, so that a disconnection causing deletion of further
+    // objects by a re-entrant call does not interfere.
+    for (auto connections = connectionRegistry.takeReceiver(pythonSelf);
+         !connections.isEmpty(); connections = connectionRegistry.takeReceiver(pythonSelf)) {
+        for (const auto &connection : std::as_const(connections))
+            QObject::disconnect(connection);
     }
 }
 
-static void clearConnectionHash()
+static void clearConnectionRegistry()
 {
-    connectionHash.clear();
+    connectionRegistry.clear();
 }
 
 void registerSlotConnection(QObject *source, int signalIndex, PyObject *callback,
                             const QMetaObject::Connection &connection)
 {
-    connectionHash.insert(connectionKey(source, signalIndex, callback), connection);
+    connectionRegistry.insert(connectionKey(source, signalIndex, callback), connection);
+
+    // Connections may be established from several threads.
+    QMutexLocker locker(&senderSignalDeletionTrackerMutex);
     if (senderSignalDeletionTracker.isNull()) {
         auto *app = QCoreApplication::instance();
         senderSignalDeletionTracker = new SenderSignalDeletionTracker(app);
-        Py_AtExit(clearConnectionHash);
+        Py_AtExit(clearConnectionRegistry);
     }
 
     QObject::connect(source, &QObject::destroyed,
@@ -404,13 +493,11 @@ void registerSlotConnection(QObject *source, int signalIndex, PyObject *callback
 
 bool disconnectSlot(QObject *source, int signalIndex, PyObject *callback)
 {
-    auto it = connectionHash.find(connectionKey(source, signalIndex, callback));
-    const bool ok = it != connectionHash.end();
-    if (ok) {
-        QObject::disconnect(it.value());
-        connectionHash.erase(it);
-    }
-    return ok;
+    const auto connection = connectionRegistry.take(connectionKey(source, signalIndex, callback));
+    if (!connection.has_value())
+        return false;
+    QObject::disconnect(connection.value());
+    return true;
 }
 
 } // namespace PySide
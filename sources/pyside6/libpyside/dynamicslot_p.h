@@ -14,6 +14,8 @@ QT_FORWARD_DECLARE_CLASS(QDebug)
 namespace PySide
 {
 
+class MetaCallConverters;
+
 class DynamicSlot
 {
     Q_DISABLE_COPY_MOVE(DynamicSlot)
@@ -28,8 +30,7 @@ public:
 
     virtual ~DynamicSlot() = default;
 
-    virtual void call(const QByteArrayList &parameterTypes, const char *returnType,
-                      void **cppArgs) = 0;
+    virtual void call(MetaCallConverters &converters, void **cppArgs) = 0;
     virtual void formatDebug(QDebug &debug) const = 0;
 
     static SlotType slotType(PyObject *callback);
@@ -33,6 +33,7 @@
 #include <sbkstaticstrings.h>
 #include <sbkfeature_base.h>
 #include <sbkmodule.h>
+#include <sbkmutex.h>
 
 #include <QtCore/QByteArray>
 #include <QtCore/QCoreApplication>
@@ -49,8 +50,10 @@
 #include <cstring>
 #include <cctype>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <typeinfo>
+#include <vector>
 
 #ifdef Q_OS_WIN
 #  include <conio.h>
@@ -831,12 +834,73 @@ QString pyUnicodeToQString(PyObject *str)
     return QString::fromUcs4(reinterpret_cast<const char32_t *>(data), len);
 }
 
-PyObject *qStringToPyUnicode(QStringView s)
+// Returns the maximum UTF-16 code unit of a string or 0xFFFFFFFF if it
+// contains surrogates. The inner loop ORs blocks of code units without
+// branching so that the compiler can vectorize it; it bails out once a
+// code unit beyond Latin-1 is seen since only surrogates matter then.
+static char32_t maxUtf16CodeUnit(const char16_t *data, qsizetype size)
+{
+    constexpr qsizetype blockSize = 16;
+    char16_t ored = 0;
+    qsizetype i = 0;
+    for ( ; i + blockSize <= size && ored < 0x100; i += blockSize) {
+        for (qsizetype b = 0; b < blockSize; ++b)
+            ored |= data[i + b];
+    }
+    for (qsizetype t = i; t < size && ored < 0x100; ++t)
+        ored |= data[t];
+    if (ored < 0x100)
+        return ored;
+
+    char16_t maxChar = 0;
+    for (qsizetype t = 0; t < size; ++t) {
+        const char16_t c = data[t];
+        if (QChar::isSurrogate(c))
+            return 0xFFFFFFFF;
+        maxChar = std::max(maxChar, c);
+    }
+    return maxChar;
+}
+
+// Slow path for strings containing surrogate pairs (or unpaired surrogates,
+// which are replaced by toUtf8()).
+static PyObject *qStringToPyUnicodeUtf8(QStringView s)
 {
     const QByteArray ba = s.toUtf8();
     return PyUnicode_FromStringAndSize(ba.constData(), ba.size());
 }
 
+// Convert the UTF-16 data directly into a str object of the narrowest kind.
+PyObject *qStringToPyUnicode(QStringView s)
+{
+    const auto size = s.size();
+    if (size == 0)
+        return PyUnicode_FromStringAndSize("", 0);
+    const auto *data = s.utf16();
+    const char32_t maxChar = maxUtf16CodeUnit(data, size);
+    if (maxChar == 0xFFFFFFFF)
+        return qStringToPyUnicodeUtf8(s);
+
+#ifdef Py_LIMITED_API
+    // No access to PyUnicode_New(), decode the UTF-16 data in native byte order.
+    int byteOrder = Q_BYTE_ORDER == Q_LITTLE_ENDIAN ? -1 : 1;
+    return PyUnicode_DecodeUTF16(reinterpret_cast<const char *>(data),
+                                 size * Py_ssize_t(sizeof(char16_t)), nullptr, &byteOrder);
+#else
+    PyObject *result = PyUnicode_New(size, Py_UCS4(maxChar));
+    if (result == nullptr)
+        return nullptr;
+    if (maxChar < 0x100) {
+        auto *target = PyUnicode_1BYTE_DATA(result);
+        for (qsizetype i = 0; i < size; ++i)
+            target[i] = Py_UCS1(data[i]);
+    } else {
+        std::memcpy(PyUnicode_2BYTE_DATA(result), data, size * sizeof(char16_t));
+    }
+    return result;
+#endif
+}
+
 // Inspired by Shiboken::String::toCString;
 QString pyStringToQString(PyObject *str)
 {
@@ -1062,6 +1126,72 @@ QMetaType qMetaTypeFromPyType(PyTypeObject *pyType)
     return QMetaType::fromName(pyType->tp_name);
 }
 
+// Converter ids by QMetaType::id(), stored as id + 1 so that 0 means "not
+// looked up yet". Builtin types and types registered at runtime (starting at
+// QMetaType::User) are kept in separate vectors. Like the Shiboken converter
+// registry, this relies on the GIL or on the mutex on free-threaded builds.
+static std::vector<int> builtinMetaTypeConverterIds;
+static std::vector<int> userMetaTypeConverterIds;
+static Shiboken::Mutex metaTypeConverterIdsMutex;
+
+static int &metaTypeConverterIdSlot(int metaTypeId)
+{
+    auto &ids = metaTypeId < QMetaType::User
+        ? builtinMetaTypeConverterIds : userMetaTypeConverterIds;
+    const auto index = std::size_t(metaTypeId < QMetaType::User
+                                   ? metaTypeId : metaTypeId - QMetaType::User);
+    if (index >= ids.size())
+        ids.resize(index + 1, 0);
+    return ids[index];
+}
+
+static void setMetaTypeConverterId(int metaTypeId, int id)
+{
+    std::lock_guard<Shiboken::Mutex> locker(metaTypeConverterIdsMutex);
+    metaTypeConverterIdSlot(metaTypeId) = id + 1;
+}
+
+int converterIdForMetaType(QMetaType metaType)
+{
+    const int metaTypeId = metaType.id();
+    if (metaTypeId <= 0)
+        return -1;
+    {
+        std::lock_guard<Shiboken::Mutex> locker(metaTypeConverterIdsMutex);
+        const int slot = metaTypeConverterIdSlot(metaTypeId);
+        if (slot != 0)
+            return slot - 1;
+    }
+
+    const char *typeNameC = metaType.name();
+    // Fix typedef "QGenericMatrix<3,3,float>" -> QMatrix3x3". The reverse
+    // conversion happens automatically in QMetaType::fromName() in
+    // QVariant_resolveMetaType(). The converter of the typedef is only
+    // available once QtGui is imported, so do not cache a failed lookup.
+    QByteArrayView typeNameV(typeNameC);
+    if (typeNameV.startsWith("QGenericMatrix<") && typeNameV.endsWith(",float>")) {
+        QByteArray typeName = typeNameV.toByteArray();
+        typeName.remove(1, 7);
+        typeName.remove(7, 1); // '<'
+        typeName.chop(7);
+        typeName.replace(',', 'x');
+        const int matrixId = Shiboken::Conversions::converterId(typeName.constData());
+        if (Shiboken::Conversions::getConverterById(matrixId) == nullptr)
+            return Shiboken::Conversions::converterId(typeNameC);
+        setMetaTypeConverterId(metaTypeId, matrixId);
+        return matrixId;
+    }
+
+    const int id = Shiboken::Conversions::converterId(typeNameC);
+    setMetaTypeConverterId(metaTypeId, id);
+    return id;
+}
+
+SbkConverter *converterForMetaType(QMetaType metaType)
+{
+    return Shiboken::Conversions::getConverterById(converterIdForMetaType(metaType));
+}
+
 debugPyTypeObject::debugPyTypeObject(const PyTypeObject *o) noexcept
     : m_object(o)
 {
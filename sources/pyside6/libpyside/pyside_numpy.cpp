@@ -2,97 +2,132 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "pyside_numpy.h"
+#include <sbkcpptonumpy.h>
 #include <sbknumpyview.h>
 
-// Convert X,Y of type T data to a list of points (QPoint, PointF)
-template <class T, class Point>
-static QList<Point>
-    xyDataToQPointHelper(const void *xData, const void *yData, qsizetype size)
+#include <utility>
+
+using Shiboken::Numpy::View;
+
+static_assert(sizeof(QPoint) == 2 * sizeof(int32_t));
+static_assert(sizeof(QPointF) == 2 * sizeof(qreal));
+
+static constexpr auto qrealViewType = sizeof(qreal) == sizeof(double)
+    ? View::Double : View::Float;
+
+// Return views of 2 one-dimensional arrays of x, y data of any layout,
+// truncated to the common size
+static std::pair<View, View> xyViews(PyObject *pyXIn, PyObject *pyYIn)
+{
+    auto xv = View::fromPyObjectStrided(pyXIn);
+    auto yv = View::fromPyObjectStrided(pyYIn);
+    if (xv.ndim != 1 || yv.ndim != 1)
+        return {};
+    xv.dimensions[0] = yv.dimensions[0] = qMin(xv.dimensions[0], yv.dimensions[0]);
+    return {xv, yv};
+}
+
+// Convert X,Y data directly into the coordinates of a list of points
+// (QPoint, QPointF)
+template <class Point>
+static QList<Point> xyDataToPoints(const View &xv, const View &yv, View::Type coordinateType)
 {
-    auto *x = reinterpret_cast<const T *>(xData);
-    auto *y = reinterpret_cast<const T *>(yData);
-    QList<Point> result;
-    result.reserve(size);
-    for (auto xEnd = x + size; x < xEnd; ++x, ++y)
-        result.append(Point(*x, *y));
+    if (!xv || xv.dimensions[0] == 0)
+        return {};
+    QList<Point> result(xv.dimensions[0]);
+    Point *points = result.data();
+    if (!xv.copyTo(coordinateType, &points->rx(), sizeof(Point))
+        || !yv.copyTo(coordinateType, &points->ry(), sizeof(Point))) {
+        return {};
+    }
     return result;
 }
 
-// Convert X,Y of double/float type data to a list of QPoint (rounding)
-template <class T>
-static QList<QPoint>
-    xyFloatDataToQPointHelper(const void *xData, const void *yData, qsizetype size)
+static bool isFloatingPoint(View::Type t)
 {
-    auto *x = reinterpret_cast<const T *>(xData);
-    auto *y = reinterpret_cast<const T *>(yData);
-    QList<QPoint> result;
-    result.reserve(size);
-    for (auto xEnd = x + size; x < xEnd; ++x, ++y)
-        result.append(QPoint(qRound(*x), qRound(*y)));
+    return t == View::Float || t == View::Double || t == View::Float16;
+}
+
+static View pointView(const QPointF *data, qsizetype size)
+{
+    View result;
+    result.ndim = 2;
+    result.type = qrealViewType;
+    result.data = const_cast<QPointF *>(data);
+    result.dimensions[0] = size;
+    result.dimensions[1] = 2;
+    result.stride[0] = sizeof(QPointF);
+    result.stride[1] = sizeof(qreal);
     return result;
 }
 
+static const char pointListCapsuleName[] = "QList<QPointF>";
+
+static void pointListCapsuleDestructor(PyObject *capsule)
+{
+    delete static_cast<QList<QPointF> *>(PyCapsule_GetPointer(capsule, pointListCapsuleName));
+}
+
 namespace PySide::Numpy
 {
 
 QList<QPointF> xyDataToQPointFList(PyObject *pyXIn, PyObject *pyYIn)
 {
-    auto xv = Shiboken::Numpy::View::fromPyObject(pyXIn);
-    auto yv = Shiboken::Numpy::View::fromPyObject(pyYIn);
-    if (!xv.sameLayout(yv))
-        return {};
-    const qsizetype size = qMin(xv.dimensions[0], yv.dimensions[0]);
-    if (size == 0)
-        return {};
-    switch (xv.type) {
-    case Shiboken::Numpy::View::Int16:
-        return xyDataToQPointHelper<int16_t, QPointF>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Unsigned16:
-        return xyDataToQPointHelper<uint16_t, QPointF>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Int:
-        return xyDataToQPointHelper<int, QPointF>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Unsigned:
-        return xyDataToQPointHelper<unsigned, QPointF>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Int64:
-        return xyDataToQPointHelper<int64_t, QPointF>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Unsigned64:
-        return xyDataToQPointHelper<uint64_t, QPointF>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Float:
-        return xyDataToQPointHelper<float, QPointF>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Double:
-        break;
-    }
-    return xyDataToQPointHelper<double, QPointF>(xv.data, yv.data, size);
+    const auto [xv, yv] = xyViews(pyXIn, pyYIn);
+    return xyDataToPoints<QPointF>(xv, yv, qrealViewType);
 }
 
 QList<QPoint> xyDataToQPointList(PyObject *pyXIn, PyObject *pyYIn)
 {
-    auto xv = Shiboken::Numpy::View::fromPyObject(pyXIn);
-    auto yv = Shiboken::Numpy::View::fromPyObject(pyYIn);
-    if (!xv.sameLayout(yv))
+    const auto [xv, yv] = xyViews(pyXIn, pyYIn);
+    if (!xv || !(isFloatingPoint(xv.type) || isFloatingPoint(yv.type)))
+        return xyDataToPoints<QPoint>(xv, yv, View::Int);
+    // Round floating point values
+    const auto pointsF = xyDataToPoints<QPointF>(xv, yv, qrealViewType);
+    QList<QPoint> result;
+    result.reserve(pointsF.size());
+    for (const auto &p : pointsF)
+        result.append(p.toPoint());
+    return result;
+}
+
+QList<QPointF> pointDataToQPointFList(PyObject *pyIn)
+{
+    const auto v = View::fromPyObjectStrided(pyIn);
+    if (!v) {
+        PyErr_Format(PyExc_TypeError,
+                     "Expected a numpy array of a numerical type, got \"%s\".",
+                     Py_TYPE(pyIn)->tp_name);
+        return {};
+    }
+    if (v.ndim != 2 || v.dimensions[1] != 2) {
+        PyErr_SetString(PyExc_ValueError, "Expected a numpy array of shape (n, 2).");
+        return {};
+    }
+    if (v.dimensions[0] == 0)
         return {};
-    const qsizetype size = qMin(xv.dimensions[0], yv.dimensions[0]);
-    if (size == 0)
+    // Copy the x, y values in C order to the coordinates
+    QList<QPointF> result(v.dimensions[0]);
+    if (!v.copyTo(qrealViewType, result.data(), sizeof(qreal))) {
+        PyErr_SetString(PyExc_TypeError, "Unsupported numpy array type.");
         return {};
-    switch (xv.type) {
-    case Shiboken::Numpy::View::Int16:
-        return xyDataToQPointHelper<int16_t, QPoint>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Unsigned16:
-        return xyDataToQPointHelper<uint16_t, QPoint>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Int:
-        return xyDataToQPointHelper<int, QPoint>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Unsigned:
-        return xyDataToQPointHelper<unsigned, QPoint>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Int64:
-        return xyDataToQPointHelper<int64_t, QPoint>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Unsigned64:
-        return xyDataToQPointHelper<uint64_t, QPoint>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Float:
-        return xyFloatDataToQPointHelper<float>(xv.data, yv.data, size);
-    case Shiboken::Numpy::View::Double:
-        break;
     }
-    return xyFloatDataToQPointHelper<double>(xv.data, yv.data, size);
+    return result;
+}
+
+PyObject *qPointFListToArray(const QList<QPointF> &points)
+{
+    // The capsule holds a shallow copy sharing the data with the list
+    auto *copy = new QList<QPointF>(points);
+    PyObject *capsule = PyCapsule_New(copy, pointListCapsuleName, pointListCapsuleDestructor);
+    if (capsule == nullptr) {
+        delete copy;
+        return nullptr;
+    }
+    PyObject *result = Shiboken::Numpy::createArrayView(pointView(copy->constData(), copy->size()),
+                                                        capsule, true);
+    Py_DECREF(capsule);
+    return result;
 }
 
 } //namespace PySide::Numpy
@@ -17,7 +17,7 @@ namespace PySide::Numpy
 {
 
 /// Create a list of QPointF from 2 equally sized numpy array of x and y data
-/// (float,double).
+/// (float,double). The arrays may be of any layout and type (slices).
 /// \param pyXIn X data array
 /// \param pyYIn Y data array
 /// \return List of QPointF
@@ -25,13 +25,29 @@ namespace PySide::Numpy
 PYSIDE_API QList<QPointF> xyDataToQPointFList(PyObject *pyXIn, PyObject *pyYIn);
 
 /// Create a list of QPoint from 2 equally sized numpy array of x and y data
-/// (int).
+/// (int). The arrays may be of any layout and type (slices).
 /// \param pyXIn X data array
 /// \param pyYIn Y data array
 /// \return List of QPoint
 
 PYSIDE_API QList<QPoint> xyDataToQPointList(PyObject *pyXIn, PyObject *pyYIn);
 
+/// Create a list of QPointF from a numpy array of shape (n, 2) containing
+/// the x, y values of the points. The array may be of any layout and type.
+/// Sets a Python error (TypeError, ValueError) for arrays of unsupported
+/// type or shape.
+/// \param pyIn Point data array
+/// \return List of QPointF
+
+PYSIDE_API QList<QPointF> pointDataToQPointFList(PyObject *pyIn);
+
+/// Create a read-only numpy array of shape (n, 2) sharing the data of a
+/// list of points (for example, a list returned by value).
+/// \param points List of points
+/// \return PyArrayObject
+
+PYSIDE_API PyObject *qPointFListToArray(const QList<QPointF> &points);
+
 } //namespace PySide::Numpy
 
 #endif // PYSIDE_NUMPY_H
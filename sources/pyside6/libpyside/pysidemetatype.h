@@ -12,6 +12,8 @@
 
 QT_FORWARD_DECLARE_CLASS(QMetaType)
 
+struct SbkConverter;
+
 namespace PySide
 {
 
@@ -21,6 +23,18 @@ namespace PySide
 /// \return QMetaType
 PYSIDE_API QMetaType qMetaTypeFromPyType(PyTypeObject *type);
 
+/// Returns the Shiboken converter id (see Shiboken::Conversions::converterId())
+/// for a QMetaType. The type name is looked up once per QMetaType::id(),
+/// the id can be passed to Shiboken::Conversions::SpecificConverter.
+/// \param metaType QMetaType
+/// \return converter id or -1 for an invalid QMetaType
+PYSIDE_API int converterIdForMetaType(QMetaType metaType);
+
+/// Returns the Shiboken converter for a QMetaType
+/// \param metaType QMetaType
+/// \return converter or nullptr
+PYSIDE_API SbkConverter *converterForMetaType(QMetaType metaType);
+
 } //namespace PySide
 
 #endif // PYSIDEMETATYPE_H
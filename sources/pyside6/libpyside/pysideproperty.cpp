@@ -139,6 +139,26 @@ int PySidePropertyPrivate::reset(PyObject *source)
     return -1;
 }
 
+// Return the converter for typeName, which is resolved once per type name.
+// A reassignment of typeName is detected by its data pointer (kept alive by
+// m_converterTypeName). The converter is refreshed when a different one is
+// registered for the name; unknown types are looked up again by id.
+Conversions::SpecificConverter *PySidePropertyPrivate::converter()
+{
+    if (typeName.constData() != m_converterTypeName.constData()) {
+        m_converterTypeName = typeName;
+        m_converterId = typeName.isEmpty()
+            ? -1 : Conversions::converterId(typeName.constData());
+        m_converter.reset();
+    }
+    SbkConverter *current = Conversions::getConverterById(m_converterId);
+    if (current == nullptr)
+        return nullptr;
+    if (!m_converter.has_value() || m_converter->converter() != current)
+        m_converter.emplace(m_converterId);
+    return &m_converter.value();
+}
+
 void PySidePropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call, void **args)
 {
     switch (call) {
@@ -146,9 +166,9 @@ void PySidePropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call, v
         AutoDecRef value(getValue(source));
         auto *obValue = value.object();
         if (obValue) {
-            Conversions::SpecificConverter converter(typeName);
+            auto *converter = this->converter();
             if (converter) {
-                converter.toCpp(obValue, args[0]);
+                converter->toCpp(obValue, args[0]);
             } else {
                 // PYSIDE-2160: Report an unknown type name to the caller `qtPropertyMetacall`.
                 PyErr_SetObject(PyExc_StopIteration, obValue);
@@ -158,9 +178,9 @@ void PySidePropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call, v
         break;
 
     case QMetaObject::WriteProperty: {
-        Conversions::SpecificConverter converter(typeName);
+        auto *converter = this->converter();
         if (converter) {
-            AutoDecRef value(converter.toPython(args[0]));
+            AutoDecRef value(converter->toPython(args[0]));
             setValue(source, value);
         } else {
             // PYSIDE-2160: Report an unknown type name to the caller `qtPropertyMetacall`.
@@ -8,11 +8,14 @@
 
 #include "pysideproperty.h"
 #include <pysidemacros.h>
+#include <sbkconverter.h>
 
 #include <QtCore/QByteArray>
 #include <QtCore/qtclasshelpermacros.h>
 #include <QtCore/QMetaObject>
 
+#include <optional>
+
 struct PySideProperty;
 
 class PYSIDE_API PySidePropertyPrivate
@@ -48,6 +51,15 @@ public:
     bool user = false;
     bool constant = false;
     bool final = false;
+
+protected:
+    Shiboken::Conversions::SpecificConverter *converter();
+
+private:
+    // Converter cache for typeName, see converter().
+    std::optional<Shiboken::Conversions::SpecificConverter> m_converter;
+    QByteArray m_converterTypeName;
+    int m_converterId = -1;
 };
 
 namespace PySide::Property {
@@ -14,15 +14,14 @@ PySideQSlotObject::PySideQSlotObject(PyObject *callable,
                                      const char *returnType) :
     QtPrivate::QSlotObjectBase(&impl),
     m_dynamicSlot(DynamicSlot::create(callable)),
-    m_parameterTypes(parameterTypes),
-    m_returnType(returnType)
+    m_converters(parameterTypes, returnType)
 {
 }
 
 void PySideQSlotObject::call(void **args)
 {
     Shiboken::GilState state;
-    m_dynamicSlot->call(m_parameterTypes, m_returnType, args);
+    m_dynamicSlot->call(m_converters, args);
 }
 
 PySideQSlotObject::~PySideQSlotObject() = default;
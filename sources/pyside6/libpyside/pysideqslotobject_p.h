@@ -5,6 +5,7 @@
 #define PYSIDEQSLOTOBJECT_P_H
 
 #include "pysidemacros.h"
+#include "signalmanager_p.h"
 #include <sbkpython.h>
 
 #include <QtCore/QObject>
@@ -30,8 +31,7 @@ private:
     void call(void **args);
 
     std::unique_ptr<DynamicSlot> m_dynamicSlot;
-    const QByteArrayList m_parameterTypes;
-    const char *m_returnType;
+    MetaCallConverters m_converters;
 };
 
 
@@ -11,6 +11,7 @@
 #include "signalmanager.h"
 
 #include <shiboken.h>
+#include <sbkmutex.h>
 #include <sbkstaticstrings.h>
 
 #include <QtCore/QByteArray>
@@ -24,6 +25,7 @@
 #include <sbkenum.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <optional>
 #include <utility>
 #include <cstring>
@@ -575,11 +577,119 @@ static PyObject *signalInstanceConnect(PyObject *self, PyObject *args, PyObject
     return nullptr;
 }
 
+// Arguments of signals emitted directly by signalInstanceEmit() are
+// converted into stack storage of this size.
+static constexpr int maxDirectEmitArguments = 6;
+
+struct alignas(std::max_align_t) DirectEmitArgument
+{
+    char data[32];
+};
+
 static int argCountInSignature(const char *signature)
 {
     return QByteArrayView{signature}.count(',') + 1;
 }
 
+// Resolve the signal index and the parameters for emitting a signal directly.
+// Signals with parameters that cannot be converted are left to QObject.emit(),
+// which reports the errors.
+static void resolveEmitData(PySideSignalEmitData &data, const QMetaObject *metaObject,
+                            const QByteArray &signature)
+{
+    data.metaObject = metaObject;
+    data.signalIndex = -1;
+    data.parameters.clear();
+
+    const int signalIndex = metaObject->indexOfSignal(signature.constData());
+    if (signalIndex == -1)
+        return;
+    const QMetaMethod method = metaObject->method(signalIndex);
+    const int parameterCount = method.parameterCount();
+    if (parameterCount > maxDirectEmitArguments)
+        return;
+    data.parameters.reserve(parameterCount);
+    for (int p = 0; p < parameterCount; ++p) {
+        Shiboken::Conversions::SpecificConverter converter(method.parameterTypeName(p).constData());
+        if (!converter)
+            return;
+        QMetaType metaType;
+        if (!Shiboken::Conversions::pythonTypeIsObjectType(converter)) {
+            metaType = method.parameterMetaType(p);
+            if (!metaType.isValid() || !metaType.isDefaultConstructible()
+                || metaType.sizeOf() > qsizetype(sizeof(DirectEmitArgument))
+                || metaType.alignOf() > qsizetype(alignof(DirectEmitArgument))) {
+                return;
+            }
+        }
+        data.parameters.push_back({metaType, converter});
+    }
+    data.signalIndex = signalIndex;
+}
+
+enum class DirectEmitResult { Emitted, Error, Unhandled };
+
+// Emit a signal via QMetaObject::activate() with the arguments converted into
+// stack storage, avoiding the argument list and signature string of QObject.emit().
+static DirectEmitResult emitDirectly(PySideSignalInstance *source, PyObject *args)
+{
+    PyObject *pySource = source->d->source;
+    if (!Shiboken::Object::isValid(pySource, false))
+        return DirectEmitResult::Unhandled;
+    QObject *object = PySide::convertToQObject(pySource, false);
+    if (object == nullptr)
+        return DirectEmitResult::Unhandled;
+
+    const QMetaObject *metaObject = object->metaObject();
+    std::shared_ptr<PySideSignalEmitData> emitData;
+    {
+        Shiboken::CriticalSection section(reinterpret_cast<PyObject *>(source));
+        auto &current = source->d->emitData;
+        if (!current || current->metaObject != metaObject) {
+            auto resolved = std::make_shared<PySideSignalEmitData>();
+            resolveEmitData(*resolved, metaObject, source->d->signature);
+            current = std::move(resolved);
+        }
+        emitData = current;
+    }
+    auto &data = *emitData;
+    const auto argCount = PyTuple_Size(args);
+    if (data.signalIndex == -1 || argCount != Py_ssize_t(data.parameters.size()))
+        return DirectEmitResult::Unhandled;
+
+    DirectEmitArgument storage[maxDirectEmitArguments];
+    void *argv[maxDirectEmitArguments + 1] = {nullptr};
+    Py_ssize_t constructed = 0;
+    for (; constructed < argCount; ++constructed) {
+        auto &parameter = data.parameters[constructed];
+        void *arg = &storage[constructed];
+        if (parameter.metaType.isValid())
+            parameter.metaType.construct(arg);
+        else
+            *reinterpret_cast<void **>(arg) = nullptr;
+        argv[constructed + 1] = arg;
+        parameter.converter.toCpp(PyTuple_GetItem(args, constructed), arg);
+        if (PyErr_Occurred() != nullptr) {
+            ++constructed;
+            break;
+        }
+    }
+
+    const bool ok = PyErr_Occurred() == nullptr;
+    if (ok) {
+        Py_BEGIN_ALLOW_THREADS
+        QMetaObject::activate(object, data.signalIndex, argv);
+        Py_END_ALLOW_THREADS
+    }
+
+    for (Py_ssize_t i = 0; i < constructed; ++i) {
+        const auto &metaType = data.parameters[i].metaType;
+        if (metaType.isValid())
+            metaType.destruct(argv[i + 1]);
+    }
+    return ok ? DirectEmitResult::Emitted : DirectEmitResult::Error;
+}
+
 static PyObject *signalInstanceEmit(PyObject *self, PyObject *args)
 {
     auto *source = reinterpret_cast<PySideSignalInstance *>(self);
@@ -591,7 +701,6 @@ static PyObject *signalInstanceEmit(PyObject *self, PyObject *args)
     if (source->deleted)
         return PyErr_Format(PyExc_RuntimeError, "The SignalInstance object was already deleted");
 
-    Shiboken::AutoDecRef pyArgs(PyList_New(0));
     Py_ssize_t numArgsGiven = PySequence_Size(args);
     int numArgsInSignature = argCountInSignature(source->d->signature);
 
@@ -613,6 +722,17 @@ static PyObject *signalInstanceEmit(PyObject *self, PyObject *args)
             }
         }
     }
+
+    switch (emitDirectly(source, args)) {
+    case DirectEmitResult::Emitted:
+        Py_RETURN_TRUE;
+    case DirectEmitResult::Error:
+        return nullptr;
+    case DirectEmitResult::Unhandled:
+        break;
+    }
+
+    Shiboken::AutoDecRef pyArgs(PyList_New(0));
     Shiboken::AutoDecRef sourceSignature(PySide::Signal::buildQtCompatible(source->d->signature));
 
     PyList_Append(pyArgs, sourceSignature);
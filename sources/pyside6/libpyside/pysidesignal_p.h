@@ -5,9 +5,16 @@
 #define PYSIDE_QSIGNAL_P_H
 
 #include <sbkpython.h>
+#include <sbkconverter.h>
 
 #include <QtCore/QByteArray>
 #include <QtCore/QList>
+#include <QtCore/QMetaType>
+
+#include <memory>
+#include <vector>
+
+QT_FORWARD_DECLARE_STRUCT(QMetaObject)
 
 struct PySideSignalData
 {
@@ -36,6 +43,21 @@ extern "C"
     struct PySideSignalInstance;
 }; //extern "C"
 
+// Signal index and parameters resolved on the first emission of a signal
+// instance, used for emitting it directly via QMetaObject::activate().
+struct PySideSignalEmitData
+{
+    struct Parameter
+    {
+        QMetaType metaType; // Invalid for object types passed by pointer
+        Shiboken::Conversions::SpecificConverter converter;
+    };
+
+    const QMetaObject *metaObject = nullptr; // Meta object the data were resolved for
+    int signalIndex = -1; // -1: Emit via QObject.emit()
+    std::vector<Parameter> parameters;
+};
+
 struct PySideSignalInstancePrivate
 {
     QByteArray signalName;
@@ -45,6 +67,9 @@ struct PySideSignalInstancePrivate
     PySideSignalInstance *next = nullptr;
     unsigned short attributes = 0;
     short argCount = 0;
+    // Replaced when resolving for another meta object, shared with running
+    // emissions (protected by the critical section of the instance).
+    std::shared_ptr<PySideSignalEmitData> emitData;
 };
 
 namespace PySide::Signal {
@@ -27,6 +27,7 @@ PYSIDE_API bool inherits(PyTypeObject *self, const char *class_name);
 PYSIDE_API QString pyUnicodeToQString(PyObject *str);
 
 /// Given a QString, return the PyObject repeesenting Unicode data.
+/// The UTF-16 data is copied directly into a str of the narrowest kind.
 PYSIDE_API PyObject *qStringToPyUnicode(QStringView s);
 
 /// Given A PyObject representing ASCII or Unicode data, returns an equivalent QString.
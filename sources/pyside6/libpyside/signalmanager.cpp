@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "signalmanager.h"
+#include "signalmanager_p.h"
 #include "pysidesignal.h"
 #include "pysidelogging_p.h"
 #include "pysideproperty.h"
@@ -15,6 +16,7 @@
 #include <bindingmanager.h>
 #include <gilstate.h>
 #include <sbkconverter.h>
+#include <sbkmutex.h>
 #include <sbkstring.h>
 #include <sbkstaticstrings.h>
 #include <sbkerrors.h>
@@ -23,10 +25,11 @@
 #include <QtCore/QByteArrayView>
 #include <QtCore/QDebug>
 #include <QtCore/QHash>
-#include <QtCore/QScopedPointer>
+#include <QtCore/QList>
 #include <QtCore/QTimerEvent>
 
 #include <memory>
+#include <mutex>
 
 using namespace Qt::StringLiterals;
 
@@ -238,6 +241,12 @@ struct SignalManagerPrivate
 SignalManager::QmlMetaCallErrorHandler
     SignalManagerPrivate::m_qmlMetaCallErrorHandler = nullptr;
 
+struct MetaMethodCacheEntry;
+using MetaMethodCacheEntryPtr = std::shared_ptr<MetaMethodCacheEntry>;
+static MetaMethodCacheEntryPtr metaMethodCacheEntry(const QMetaMethod &method);
+static int callPythonMetaMethod(const QMetaMethod &method, MetaMethodCacheEntry &entry,
+                                void **args, PyObject *callable);
+
 static void PyObject_PythonToCpp_PyObject_PTR(PyObject *pyIn, void *cppOut)
 {
     *reinterpret_cast<PyObject **>(cppOut) = pyIn;
@@ -393,14 +402,13 @@ int SignalManagerPrivate::qtMethodMetacall(QObject *object,
         auto *pySbkSelf = Shiboken::BindingManager::instance().retrieveWrapper(object);
         Q_ASSERT(pySbkSelf);
         auto *pySelf = reinterpret_cast<PyObject *>(pySbkSelf);
-        QByteArray methodName = method.methodSignature();
-        methodName.truncate(methodName.indexOf('('));
-        Shiboken::AutoDecRef pyMethod(PyObject_GetAttrString(pySelf, methodName));
+        auto cacheEntry = metaMethodCacheEntry(method);
+        Shiboken::AutoDecRef pyMethod(PyObject_GetAttr(pySelf, cacheEntry->name()));
         if (pyMethod.isNull()) {
             PyErr_Format(PyExc_AttributeError, "Slot '%s::%s' not found.",
                          metaObject->className(), method.methodSignature().constData());
         } else {
-            SignalManager::callPythonMetaMethod(method, args, pyMethod);
+            callPythonMetaMethod(method, *cacheEntry, args, pyMethod);
         }
     }
     // WARNING Isn't safe to call any metaObject and/or object methods beyond this point
@@ -460,46 +468,143 @@ static inline bool isNonVoidReturn(const char *returnType)
     return returnType != nullptr && returnType[0] != 0 && std::strcmp("void", returnType) != 0;
 }
 
-static int callPythonMetaMethodHelper(const QByteArrayList &paramTypes,
-                                      const char *returnType /* = nullptr */,
-                                      void **args, PyObject *pyCallable)
+MetaCallConverters::MetaCallConverters(const QByteArrayList &parameterTypes,
+                                       const char *returnType) :
+    m_parameterTypes(parameterTypes)
 {
-    const qsizetype argsSize = paramTypes.size();
-    Shiboken::AutoDecRef preparedArgs(PyTuple_New(argsSize));
+    if (isNonVoidReturn(returnType))
+        m_returnType = returnType;
+}
 
-    for (qsizetype i = 0; i < argsSize; ++i) {
-        void *data = args[i + 1];
-        auto param = paramTypes.at(i);
-        Shiboken::Conversions::SpecificConverter converter(param.constData());
+// Resolve the converters by name. Unknown types are not cached since
+// the module registering them might be imported later.
+int MetaCallConverters::resolve()
+{
+    m_parameterConverters.clear();
+    m_returnConverter.reset();
+    m_parameterConverters.reserve(m_parameterTypes.size());
+    for (qsizetype i = 0, size = m_parameterTypes.size(); i < size; ++i) {
+        Shiboken::Conversions::SpecificConverter converter(m_parameterTypes.at(i).constData());
         if (!converter.isValid())
             return CallResult::CallArgumentError + int(i);
-        PyTuple_SetItem(preparedArgs, i, converter.toPython(data));
+        m_parameterConverters.push_back(converter);
     }
-
-    QScopedPointer<Shiboken::Conversions::SpecificConverter> retConverter;
-    if (isNonVoidReturn(returnType)) {
-        retConverter.reset(new Shiboken::Conversions::SpecificConverter(returnType));
-        if (!retConverter->isValid())
+    if (!m_returnType.isEmpty()) {
+        m_returnConverter.emplace(m_returnType.constData());
+        if (!m_returnConverter->isValid())
             return CallResult::CallReturnValueError;
     }
+    m_resolved = true;
+    return CallResult::CallOk;
+}
+
+int MetaCallConverters::call(void **args, PyObject *pyCallable)
+{
+    if (!m_resolved) {
+        const int resolveResult = resolve();
+        if (resolveResult != CallResult::CallOk)
+            return resolveResult;
+    }
+
+    const auto argsSize = Py_ssize_t(m_parameterConverters.size());
+    Shiboken::AutoDecRef preparedArgs(PyTuple_New(argsSize));
+    for (Py_ssize_t i = 0; i < argsSize; ++i)
+        PyTuple_SetItem(preparedArgs, i, m_parameterConverters[i].toPython(args[i + 1]));
 
     Shiboken::AutoDecRef retval(PyObject_CallObject(pyCallable, preparedArgs.object()));
     if (PyErr_Occurred() != nullptr || retval.isNull())
         return CallResult::CallOtherError;
 
-    if (retval != Py_None && !retConverter.isNull())
-        retConverter->toCpp(retval, args[0]);
+    if (retval != Py_None && m_returnConverter.has_value())
+        m_returnConverter->toCpp(retval, args[0]);
     return CallResult::CallOk;
 }
 
-int SignalManager::callPythonMetaMethod(QMetaMethod method, void **args,
-                                        PyObject *callable)
+// Data cached for calling the methods of meta objects by method index.
+// The static meta objects of the Qt classes live forever; entries of the
+// dynamic meta objects created by MetaObjectBuilder are removed by
+// clearMetaCallConverters(). The entries are shared since the hash may be
+// modified while calling into Python.
+static Shiboken::Mutex metaMethodCacheMutex; // For free-threaded builds
+
+struct MetaMethodCacheEntry
+{
+    explicit MetaMethodCacheEntry(const QMetaMethod &method) :
+        converters(method.parameterTypes(), method.typeName()),
+        methodName(method.name())
+    {
+    }
+
+    /// Interned name for looking up the Python method, created on first use
+    PyObject *name()
+    {
+        Shiboken::DetachingLocker<Shiboken::Mutex> locker(metaMethodCacheMutex);
+        if (pyName == nullptr)
+            pyName = PyUnicode_InternFromString(methodName.constData());
+        return pyName;
+    }
+
+    MetaCallConverters converters;
+    QByteArray methodName;
+    PyObject *pyName = nullptr; // Not released on exit when Python is gone
+};
+
+using MetaMethodKey = std::pair<const QMetaObject *, int>;
+using MetaMethodCache = QHash<MetaMethodKey, MetaMethodCacheEntryPtr>;
+
+Q_GLOBAL_STATIC(MetaMethodCache, metaMethodCache)
+
+static MetaMethodCacheEntryPtr metaMethodCacheEntry(const QMetaMethod &method)
+{
+    const MetaMethodKey key{method.enclosingMetaObject(), method.methodIndex()};
+    auto &hash = *metaMethodCache();
+    {
+        std::lock_guard<Shiboken::Mutex> locker(metaMethodCacheMutex);
+        auto it = hash.constFind(key);
+        if (it != hash.cend())
+            return it.value();
+    }
+    // Resolving the converters may load lazy classes, do not hold the lock.
+    auto entry = std::make_shared<MetaMethodCacheEntry>(method);
+    std::lock_guard<Shiboken::Mutex> locker(metaMethodCacheMutex);
+    auto it = hash.find(key);
+    if (it == hash.end())
+        it = hash.insert(key, entry);
+    return it.value();
+}
+
+void PySide::clearMetaCallConverters(const QMetaObject *metaObject)
+{
+    if (metaMethodCache.isDestroyed())
+        return;
+    QList<MetaMethodCacheEntryPtr> removed;
+    {
+        std::lock_guard<Shiboken::Mutex> locker(metaMethodCacheMutex);
+        auto &hash = *metaMethodCache();
+        for (auto it = hash.begin(); it != hash.end(); ) {
+            if (it.key().first == metaObject) {
+                removed.append(it.value());
+                it = hash.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    for (const auto &entry : std::as_const(removed)) {
+        if (entry->pyName != nullptr) {
+            Shiboken::GilState gil;
+            Py_CLEAR(entry->pyName);
+        }
+    }
+}
+
+static int callPythonMetaMethod(const QMetaMethod &method, MetaMethodCacheEntry &entry,
+                                void **args, PyObject *callable)
 {
     Q_ASSERT(callable);
 
     Shiboken::GilState gil;
-    int callResult = callPythonMetaMethodHelper(method.parameterTypes(),
-                                                method.typeName(), args, callable);
+    int callResult = entry.converters.call(args, callable);
     switch (callResult) {
     case CallOk:
         return 0;
@@ -517,6 +622,13 @@ int SignalManager::callPythonMetaMethod(QMetaMethod method, void **args,
     return 0;
 }
 
+int SignalManager::callPythonMetaMethod(QMetaMethod method, void **args,
+                                        PyObject *callable)
+{
+    auto cacheEntry = metaMethodCacheEntry(method);
+    return ::callPythonMetaMethod(method, *cacheEntry, args, callable);
+}
+
 static QByteArray signature(const char *name, const QByteArrayList &parameterTypes,
                             const char *returnType)
 {
@@ -527,27 +639,28 @@ static QByteArray signature(const char *name, const QByteArrayList &parameterTyp
     return result;
 }
 
-int SignalManager::callPythonMetaMethod(const QByteArrayList &parameterTypes,
-                                        const char *returnType,
-                                        void **args, PyObject *callable)
+int PySide::callPythonMetaMethod(MetaCallConverters &converters, void **args,
+                                 PyObject *callable)
 {
     Q_ASSERT(callable);
 
     Shiboken::GilState gil;
-    int callResult = callPythonMetaMethodHelper(parameterTypes, returnType, args, callable);
+    int callResult = converters.call(args, callable);
     switch (callResult) {
     case CallOk:
         return 0;
     case CallOtherError:
         return -1;
     case CallReturnValueError: {
-        const auto &sig = signature("slot", parameterTypes, returnType);
+        const auto &sig = signature("slot", converters.parameterTypes(),
+                                    converters.returnType().constData());
         PyErr_SetString(PyExc_RuntimeError, msgCannotConvertReturn(sig).constData());
         return -1;
     }
     default: { // CallArgumentError + n
         const int arg = callResult - CallArgumentError;
-        const auto &sig = signature("slot", parameterTypes, returnType);
+        const auto &parameterTypes = converters.parameterTypes();
+        const auto &sig = signature("slot", parameterTypes, converters.returnType().constData());
         const auto &msg = msgCannotConvertParameter(parameterTypes.at(arg), sig, arg);
         PyErr_SetString(PyExc_TypeError, msg.constData());
         return -1;
@@ -556,6 +669,14 @@ int SignalManager::callPythonMetaMethod(const QByteArrayList &parameterTypes,
     return 0;
 }
 
+int SignalManager::callPythonMetaMethod(const QByteArrayList &parameterTypes,
+                                        const char *returnType,
+                                        void **args, PyObject *callable)
+{
+    MetaCallConverters converters(parameterTypes, returnType);
+    return PySide::callPythonMetaMethod(converters, args, callable);
+}
+
 bool SignalManager::registerMetaMethod(QObject *source, const char *signature, QMetaMethod::MethodType type)
 {
     int ret = registerMetaMethodGetIndex(source, signature, type);
@@ -0,0 +1,54 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef SIGNALMANAGER_P_H
+#define SIGNALMANAGER_P_H
+
+#include <sbkpython.h>
+#include <sbkconverter.h>
+
+#include <QtCore/QByteArrayList>
+#include <QtCore/QMetaObject>
+
+#include <optional>
+#include <vector>
+
+namespace PySide
+{
+
+/// Converters for the parameters and the return value of a signal/slot
+/// signature. They are resolved from the type names on first use, so that
+/// repeated invocations of Python callables do not look up converters by name.
+class MetaCallConverters
+{
+public:
+    explicit MetaCallConverters(const QByteArrayList &parameterTypes,
+                                const char *returnType = nullptr);
+
+    const QByteArrayList &parameterTypes() const { return m_parameterTypes; }
+    const QByteArray &returnType() const { return m_returnType; }
+
+    /// Call a Python callable with the arguments received in qt_metacall.
+    /// Returns 0 or a CallResult value indicating the error.
+    int call(void **args, PyObject *callable);
+
+private:
+    int resolve();
+
+    QByteArrayList m_parameterTypes;
+    QByteArray m_returnType;
+    std::vector<Shiboken::Conversions::SpecificConverter> m_parameterConverters;
+    std::optional<Shiboken::Conversions::SpecificConverter> m_returnConverter;
+    bool m_resolved = false;
+};
+
+/// Call a Python callable using cached converters, setting a Python error on failure
+int callPythonMetaMethod(MetaCallConverters &converters, void **args, PyObject *callable);
+
+/// Remove cached converters and method names of a dynamic meta object that is
+/// about to be deleted
+void clearMetaCallConverters(const QMetaObject *metaObject);
+
+} // namespace PySide
+
+#endif // SIGNALMANAGER_P_H
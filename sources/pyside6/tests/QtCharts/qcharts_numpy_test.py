@@ -20,7 +20,7 @@ from init_paths import init_test_paths
 init_test_paths(False)
 
 from helper.usesqapplication import UsesQApplication
-from PySide6.QtCore import QCoreApplication
+from PySide6.QtCore import QCoreApplication, QPointF
 from PySide6.QtCharts import QLineSeries
 
 
@@ -32,7 +32,8 @@ class QChartsNumpyTestCase(UsesQApplication):
         """PYSIDE-2313: Verify various types."""
         line_series = QLineSeries()
         data_types = [np.short, np.ushort, np.int32, np.uint32,
-                      np.int64, np.uint64, np.float32, np.float64]
+                      np.int64, np.uint64, np.float32, np.float64,
+                      np.int8, np.uint8, np.float16]
         for dt in data_types:
             print("Testing ", dt)
             old_size = line_series.count()
@@ -45,6 +46,57 @@ class QChartsNumpyTestCase(UsesQApplication):
             self.assertEqual(point.x(), 2)
             self.assertEqual(point.y(), 3)
 
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testStrided(self):
+        """Verify that slices and Fortran order arrays are accepted."""
+        line_series = QLineSeries()
+        data = np.arange(20, dtype=np.float64).reshape(10, 2)
+        line_series.appendNp(data[::2, 0], data[::2, 1])
+        self.assertEqual(line_series.count(), 5)
+        self.assertEqual(line_series.points()[1].x(), 4)
+        self.assertEqual(line_series.points()[1].y(), 5)
+        line_series.replaceNp(np.asfortranarray(data)[::-1])
+        self.assertEqual(line_series.count(), 10)
+        self.assertEqual(line_series.points()[0].x(), 18)
+        self.assertEqual(line_series.points()[0].y(), 19)
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testBoolAndComplex(self):
+        """Verify that bool arrays are converted and complex arrays are rejected."""
+        line_series = QLineSeries()
+        line_series.appendNp(np.array([True, False]), np.array([False, True]))
+        self.assertEqual(line_series.points(), [QPointF(1, 0), QPointF(0, 1)])
+        data = np.array([[True, False], [False, True]])
+        line_series.replaceNp(data[:, ::-1])
+        self.assertEqual(line_series.points(), [QPointF(0, 1), QPointF(1, 0)])
+        for dt in (np.complex64, np.complex128):
+            with self.assertRaises(TypeError):
+                line_series.replaceNp(np.array([[1 + 2j, 3 - 4j]], dtype=dt))
+        self.assertEqual(line_series.count(), 2)
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testPoints(self):
+        line_series = QLineSeries()
+        line_series.replaceNp(np.array([[1, 2], [3, 4]], dtype=np.float64))
+        self.assertEqual(line_series.count(), 2)
+        points = line_series.pointsNp()
+        self.assertEqual(points.shape, (2, 2))
+        self.assertEqual(points[1, 0], 3)
+        self.assertFalse(points.flags.writeable)
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testPointsInvalid(self):
+        """Verify that arrays of wrong shape or type raise errors."""
+        line_series = QLineSeries()
+        line_series.replaceNp(np.array([[1, 2]], dtype=np.float64))
+        with self.assertRaises(ValueError):
+            line_series.replaceNp(np.array([[1, 2, 3]], dtype=np.float64))
+        with self.assertRaises(ValueError):
+            line_series.replaceNp(np.zeros((2, 2, 2)))
+        with self.assertRaises(TypeError):
+            line_series.replaceNp(np.array([["a", "b"]]))
+        self.assertEqual(line_series.count(), 1)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -307,6 +307,17 @@ class QDataStreamBuffer(unittest.TestCase):
         data = QDataStream(ba)
         self.assertEqual(data.readRawData(3), test_data)
 
+    def testRawDataIntoBuffer(self):
+        test_data = b'AB\0CD'
+        ba = QByteArray(test_data)
+        data = QDataStream(ba)
+        target = bytearray(4)
+        self.assertEqual(data.readRawData(target), 4)
+        self.assertEqual(target, b'AB\0C')
+        self.assertEqual(data.readRawData(target), 1)
+        self.assertEqual(target[:1], b'D')
+        self.assertEqual(QDataStream().readRawData(target), None)
+
     def testBytes(self):
         dataOne = QDataStream()
         self.assertEqual(dataOne.readBytes(4), None)
@@ -74,6 +74,22 @@ class TestQIODeviceBufferedRead(unittest.TestCase):
         self.assertEqual(bytes_read, bytes_read_again2)
         self.assertEqual(response_again2, response2)
 
+    def test_readinto(self) -> None:
+        response = bytearray(1024)
+        bytes_read = self.buffer.readinto(response)
+        self.assertEqual(bytes_read, len(self.text))
+        self.assertEqual(response[:bytes_read].decode("utf-8"), self.text)
+
+        # Reads are limited to the size of the buffer
+        self.buffer.seek(0)
+        response = bytearray(6)
+        self.assertEqual(self.buffer.readinto(memoryview(response)), 6)
+        self.assertEqual(response, b"Tomato")
+        self.assertEqual(self.buffer.read(response, 1024), 6)
+        self.assertEqual(response, b" juice")
+
+        self.assertRaises(TypeError, self.buffer.readinto, b"read-only")
+
 
 if __name__ == "__main__":
     unittest.main()
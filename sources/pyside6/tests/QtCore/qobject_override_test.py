@@ -0,0 +1,83 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for overriding virtual methods by assigning to the class
+   after instances exist (override cache of the BindingManager)'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QCoreApplication, QEvent, QObject
+
+from helper.usesqapplication import UsesQApplication
+
+
+class MyObject(QObject):
+    pass
+
+
+class MyDerivedObject(MyObject):
+    pass
+
+
+def userEvent(self, event):
+    if event.type() == QEvent.Type.User:
+        self.user_events += 1
+        return True
+    return QObject.event(self, event)
+
+
+class QObjectOverrideTest(UsesQApplication):
+    '''C++ calls of QObject::event() follow overrides added to or removed
+       from the class.'''
+
+    def sendUserEvent(self, obj):
+        return QCoreApplication.sendEvent(obj, QEvent(QEvent.Type.User))
+
+    def testAddRemoveOverride(self):
+        obj = MyObject()
+        obj.user_events = 0
+        # Populate the cache of methods not overridden
+        self.assertFalse(self.sendUserEvent(obj))
+        self.assertFalse(self.sendUserEvent(obj))
+        self.assertEqual(obj.user_events, 0)
+
+        MyObject.event = userEvent
+        try:
+            self.assertTrue(self.sendUserEvent(obj))
+            self.assertEqual(obj.user_events, 1)
+            newObj = MyObject()
+            newObj.user_events = 0
+            self.assertTrue(self.sendUserEvent(newObj))
+            self.assertEqual(newObj.user_events, 1)
+        finally:
+            del MyObject.event
+
+        self.assertFalse(self.sendUserEvent(obj))
+        self.assertEqual(obj.user_events, 1)
+
+    def testOverrideInBaseClass(self):
+        obj = MyDerivedObject()
+        obj.user_events = 0
+        self.assertFalse(self.sendUserEvent(obj))
+
+        MyObject.event = userEvent
+        try:
+            self.assertTrue(self.sendUserEvent(obj))
+            self.assertEqual(obj.user_events, 1)
+        finally:
+            del MyObject.event
+
+        self.assertFalse(self.sendUserEvent(obj))
+        self.assertEqual(obj.user_events, 1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,63 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for QThreadPool.startMany() and QThreadPool.map()'''
+
+import os
+import sys
+import unittest
+
+from concurrent.futures import wait
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QThreadPool
+
+
+def square(value):
+    if value < 0:
+        raise ValueError(f"negative value {value}")
+    return value * value
+
+
+class QThreadPoolMapTest(unittest.TestCase):
+    def setUp(self):
+        self.pool = QThreadPool()
+        self.pool.setMaxThreadCount(4)
+
+    def tearDown(self):
+        self.assertTrue(self.pool.waitForDone())
+        del self.pool
+
+    def testMap(self):
+        futures = self.pool.map(square, range(1000))
+        self.assertEqual(len(futures), 1000)
+        self.assertEqual([f.result() for f in futures], [v * v for v in range(1000)])
+
+    def testMapChunkSize(self):
+        futures = self.pool.map(square, [1, 2, 3], chunkSize=1)
+        self.assertEqual([f.result() for f in futures], [1, 4, 9])
+
+    def testStartMany(self):
+        futures = self.pool.startMany([lambda v=v: square(v) for v in range(10)])
+        done, not_done = wait(futures)
+        self.assertFalse(not_done)
+        self.assertEqual([f.result() for f in futures], [v * v for v in range(10)])
+
+    def testExceptions(self):
+        futures = self.pool.map(square, [2, -1, 3])
+        self.assertEqual(futures[0].result(), 4)
+        self.assertIsInstance(futures[1].exception(), ValueError)
+        self.assertRaises(ValueError, futures[1].result)
+        self.assertEqual(futures[2].result(), 9)
+
+    def testNotCallable(self):
+        self.assertRaises(TypeError, self.pool.startMany, [square, 42])
+
+
+if __name__ == '__main__':
+    unittest.main()
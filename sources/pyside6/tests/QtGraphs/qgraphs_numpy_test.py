@@ -31,7 +31,8 @@ class QGraphsNumpyTestCase(UsesQApplication):
         """PYSIDE-2313: Verify various types."""
         line_series = QLineSeries()
         data_types = [np.short, np.ushort, np.int32, np.uint32,
-                      np.int64, np.uint64, np.float32, np.float64]
+                      np.int64, np.uint64, np.float32, np.float64,
+                      np.int8, np.uint8, np.float16]
         for dt in data_types:
             print("Testing ", dt)
             old_size = line_series.count()
@@ -44,6 +45,19 @@ class QGraphsNumpyTestCase(UsesQApplication):
             self.assertEqual(point.x(), 2)
             self.assertEqual(point.y(), 3)
 
+    def testStrided(self):
+        """Verify that slices and Fortran order arrays are accepted."""
+        line_series = QLineSeries()
+        data = np.arange(20, dtype=np.float64).reshape(10, 2)
+        line_series.appendNp(data[::2, 0], data[::2, 1])
+        self.assertEqual(line_series.count(), 5)
+        self.assertEqual(line_series.points()[1].x(), 4)
+        self.assertEqual(line_series.points()[1].y(), 5)
+        line_series.replaceNp(np.asfortranarray(data)[::-1])
+        self.assertEqual(line_series.count(), 10)
+        self.assertEqual(line_series.points()[0].x(), 18)
+        self.assertEqual(line_series.points()[0].y(), 19)
+
 
 if __name__ == '__main__':
     unittest.main()
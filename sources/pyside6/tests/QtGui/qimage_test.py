@@ -4,7 +4,9 @@ from __future__ import annotations
 
 '''Test cases for QImage'''
 
+import ctypes
 import os
+import struct
 import sys
 import unittest
 
@@ -52,6 +54,58 @@ class QImageTest(UsesQApplication):
         self.assertEqual(img.width(), 27)
         self.assertEqual(img.height(), 22)
 
+    def testBufferProtocol(self):
+        '''Test the shape, strides and format exported by the buffer protocol.'''
+        img = QImage(3, 2, QImage.Format_RGB32)
+        img.fill(0xff102030)
+        view = memoryview(img)
+        self.assertEqual(view.shape, (2, 3, 4))
+        self.assertEqual(view.strides, (12, 4, 1))
+        self.assertEqual(view.format, 'B')
+        self.assertTrue(view.readonly)
+        pixel = bytes(view.tolist()[1][2])
+        self.assertEqual(int.from_bytes(pixel, sys.byteorder), 0xff102030)
+        view.release()
+
+        # Rows are padded to 4 bytes
+        img = QImage(5, 2, QImage.Format_Grayscale16)
+        img.fill(0)
+        view = memoryview(img)
+        self.assertEqual(view.shape, (2, 5))
+        self.assertEqual(view.format, 'H')
+        self.assertEqual(view.strides, (img.bytesPerLine(), 2))
+        self.assertFalse(view.c_contiguous)
+
+    def testBufferProtocolWritable(self):
+        '''Test writing to the image through the buffer protocol.'''
+        img = QImage(3, 2, QImage.Format_RGB32)
+        img.fill(0xff000000)
+        struct.pack_into('=I', img, 4 * 4, 0xff102030)
+        self.assertEqual(img.pixel(1, 1), 0xff102030)
+        self.assertEqual(img.pixel(0, 1), 0xff000000)
+
+    def testBufferProtocolWritableKeepsData(self):
+        '''Test that a writable buffer stays valid when the image data is replaced.'''
+        img = QImage(3, 2, QImage.Format_RGB32)
+        img.fill(0xff000000)
+        pixels = (ctypes.c_uint32 * 6).from_buffer(img)
+        pixels[4] = 0xff102030
+        self.assertEqual(img.pixel(1, 1), 0xff102030)
+        img.convertTo(QImage.Format_Grayscale8)
+        pixels[4] = 0xff405060
+        self.assertEqual(pixels[4], 0xff405060)
+        del pixels
+
+    def testBufferProtocolReadOnlyCopy(self):
+        '''Test that read-only buffers are not affected by modifying the image.'''
+        img = QImage(3, 2, QImage.Format_RGB32)
+        img.fill(0xff102030)
+        view = memoryview(img)
+        img.fill(0xff000000)
+        img = img.scaled(30, 20)
+        pixel = bytes(view.tolist()[1][2])
+        self.assertEqual(int.from_bytes(pixel, sys.byteorder), 0xff102030)
+
 
 if __name__ == '__main__':
     unittest.main()
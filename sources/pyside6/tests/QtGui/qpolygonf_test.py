@@ -5,6 +5,11 @@ from __future__ import annotations
 import os
 import sys
 import unittest
+try:
+    import numpy as np
+    HAVE_NUMPY = True
+except ModuleNotFoundError:
+    HAVE_NUMPY = False
 
 from pathlib import Path
 sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
@@ -38,6 +43,36 @@ class QPolygonFNotIterableTest(unittest.TestCase):
         p << QPoint(10, 20) << QPoint(20, 30) << [QPoint(20, 30), QPoint(40, 50)]
         self.assertEqual(len(p), 4)
 
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testNumpy(self):
+        p = QPolygonF.fromNp(np.array([[0, 1], [2, 3], [4, 5]], dtype=np.int32))
+        self.assertEqual(len(p), 3)
+        self.assertEqual(p[2], QPointF(4, 5))
+        array = p.asNp()
+        self.assertEqual(array.shape, (3, 2))
+        self.assertEqual(array[1, 1], 3)
+        self.assertFalse(array.flags.writeable)
+        copy = QPolygonF.fromNp(array)
+        self.assertEqual(copy, p)
+        # The array shares the data until the polygon is modified
+        p[0] = QPointF(10, 1)
+        p.append(QPointF(6, 7))
+        del p
+        self.assertEqual(array[0, 0], 0)
+        self.assertEqual(array.shape, (3, 2))
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testNumpyInvalid(self):
+        self.assertEqual(len(QPolygonF.fromNp(np.zeros((0, 2)))), 0)
+        with self.assertRaises(ValueError):
+            QPolygonF.fromNp(np.array([1.0, 2.0, 3.0]))
+        with self.assertRaises(ValueError):
+            QPolygonF.fromNp(np.zeros((3, 3)))
+        with self.assertRaises(TypeError):
+            QPolygonF.fromNp(np.array([["a", "b"]]))
+        with self.assertRaises(TypeError):
+            QPolygonF.fromNp(np.zeros((2, 2), dtype=np.complex128))
+
 
 if __name__ == '__main__':
     unittest.main()
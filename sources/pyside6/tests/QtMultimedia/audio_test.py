@@ -62,6 +62,23 @@ class testAudioDevices(UsesQApplication):
         actual_byte_array = QByteArray(bytearray(data))
         self.assertEqual(byte_array, actual_byte_array)
 
+    def test_sampleview(self):
+        """Test the (frameCount, channelCount) view of QAudioBuffer."""
+        format = QAudioFormat()
+        format.setSampleFormat(QAudioFormat.SampleFormat.Int16)
+        format.setChannelCount(2)
+        format.setSampleRate(48000)
+        buffer = QAudioBuffer(QByteArray(16, '\0'), format)
+        view = buffer.sampleView()
+        self.assertEqual(view.shape, (4, 2))
+        self.assertEqual(view.strides, (4, 2))
+        self.assertEqual(view.format, 'h')
+        self.assertFalse(view.readonly)
+        view[3, 1] = -2
+        data = bytes(buffer.constData())
+        self.assertEqual(data[14:16], (-2).to_bytes(2, sys.byteorder, signed=True))
+        self.assertEqual(data[:14], bytes(14))
+
 
 if __name__ == '__main__':
     unittest.main()
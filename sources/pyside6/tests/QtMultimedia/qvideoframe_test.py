@@ -0,0 +1,54 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for QVideoFrame'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from helper.usesqapplication import UsesQApplication
+from PySide6.QtCore import QSize
+from PySide6.QtMultimedia import QVideoFrame, QVideoFrameFormat
+
+
+class QVideoFrameTest(UsesQApplication):
+
+    def testPlaneView(self):
+        """Test the view of a mapped plane of a QVideoFrame."""
+        format = QVideoFrameFormat(QSize(4, 2), QVideoFrameFormat.PixelFormat.Format_ARGB8888)
+        frame = QVideoFrame(format)
+        self.assertTrue(frame.isValid())
+
+        view = frame.planeView(0, QVideoFrame.MapMode.ReadWrite)
+        self.assertEqual(view.shape, (2, 4, 4))
+        self.assertEqual(view.strides[1:], (4, 1))
+        self.assertEqual(view.format, 'B')
+        self.assertFalse(view.readonly)
+        view[1, 2, 3] = 42
+        view.release()
+
+        view = frame.planeView(0)
+        self.assertTrue(view.readonly)
+        # The view keeps the frame mapped
+        del frame
+        self.assertEqual(view[1, 2, 3], 42)
+        view.release()
+
+    def testPlaneViewInvalid(self):
+        format = QVideoFrameFormat(QSize(4, 2), QVideoFrameFormat.PixelFormat.Format_ARGB8888)
+        frame = QVideoFrame(format)
+        with self.assertRaises(RuntimeError):
+            frame.planeView(1)
+        with self.assertRaises(RuntimeError):
+            QVideoFrame().planeView(0)
+
+
+if __name__ == '__main__':
+    unittest.main()
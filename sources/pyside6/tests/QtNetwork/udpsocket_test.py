@@ -52,6 +52,13 @@ class HttpSignalsCase(unittest.TestCase):
             self.called = True
             self.app.quit()
 
+    def bufferCallback(self):
+        while self.server.hasPendingDatagrams():
+            self.buffer = bytearray(self.server.pendingDatagramSize())
+            self.size, self.host, self.port = self.server.readDatagram(self.buffer)
+            self.called = True
+            self.app.quit()
+
     def testDefaultArgs(self):
         # QUdpSocket.readDatagram pythonic return
         # @bug 124
@@ -61,6 +68,18 @@ class HttpSignalsCase(unittest.TestCase):
 
         self.assertTrue(self.called)
 
+    def testReadIntoBuffer(self):
+        # QUdpSocket.readDatagram into a writable buffer
+        self.server.readyRead.connect(self.bufferCallback)
+        self.sendPackage()
+        self.app.exec()
+
+        self.assertTrue(self.called)
+        self.assertEqual(self.size, 8)
+        self.assertEqual(self.buffer, b'datagram')
+        self.assertEqual(self.host, QHostAddress(QHostAddress.LocalHost))
+        self.assertEqual(self.port, self.socket.localPort())
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,74 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+"""Benchmark reading and writing a Python property from QML bindings."""
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from timeit import default_timer as timer
+
+from PySide6.QtCore import (QCoreApplication, QMetaObject, QObject, QUrl,
+                            Property, Q_ARG, Q_RETURN_ARG, Signal)
+from PySide6.QtQml import QQmlComponent, QQmlEngine, QmlElement
+
+
+QML_IMPORT_NAME = "propertythroughput"
+QML_IMPORT_MAJOR_VERSION = 1
+
+
+ITERATIONS = 20000
+
+
+@QmlElement
+class Counter(QObject):
+    valueChanged = Signal()
+
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self._value = 0
+
+    @Property(int, notify=valueChanged)
+    def value(self):
+        return self._value
+
+    @value.setter
+    def value(self, v):
+        if self._value != v:
+            self._value = v
+            self.valueChanged.emit()
+
+
+class TestQmlPropertyThroughput(unittest.TestCase):
+    def testReadWrite(self):
+        app = QCoreApplication.instance() or QCoreApplication(sys.argv)  # noqa: F841
+        file = Path(__file__).resolve().parent / "propertythroughput.qml"
+        engine = QQmlEngine()
+        component = QQmlComponent(engine, QUrl.fromLocalFile(file))
+        root = component.create()
+        self.assertTrue(root, "\n".join(str(e) for e in component.errors()))
+
+        start_time = timer()
+        result = QMetaObject.invokeMethod(root, "run", Q_RETURN_ARG(int),
+                                          Q_ARG(int, ITERATIONS))
+        elapsed = timer() - start_time
+
+        # Each iteration writes once and reads value and the binding (3 * i)
+        self.assertEqual(result, 3 * ITERATIONS * (ITERATIONS - 1) // 2)
+        self.assertEqual(root.property("counter").value, ITERATIONS - 1)
+        print(f"\n{ITERATIONS} QML property write/read iterations: "
+              f"{elapsed * 1e6 / ITERATIONS:.2f} us/iteration", file=sys.stderr)
+
+        del root
+        del engine
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,20 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQml
+import propertythroughput
+
+QtObject {
+    property Counter counter: Counter {}
+    // Binding re-evaluated on each change of the Python property
+    property int doubled: counter.value * 2
+
+    function run(iterations: int): int {
+        let sum = 0
+        for (let i = 0; i < iterations; ++i) {
+            counter.value = i
+            sum += counter.value + doubled
+        }
+        return sum
+    }
+}
@@ -0,0 +1,60 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for the numpy views of QSGGeometry'''
+
+import os
+import sys
+import unittest
+try:
+    import numpy as np
+    HAVE_NUMPY = True
+except ModuleNotFoundError:
+    HAVE_NUMPY = False
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtQuick import QSGGeometry
+
+
+class QSGGeometryNumpyTest(unittest.TestCase):
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testVertexData(self):
+        geometry = QSGGeometry(QSGGeometry.defaultAttributes_Point2D(), 4, 6)
+        vertexes = geometry.vertexDataNp()
+        self.assertEqual(vertexes.shape, (4, 2))
+        self.assertEqual(vertexes.dtype, np.float32)
+        self.assertTrue(vertexes.flags.writeable)
+        # The array references the vertex data of the geometry
+        vertexes[:] = [[0, 1], [2, 3], [4, 5], [6, 7]]
+        points = geometry.vertexDataAsPoint2D()
+        self.assertEqual(len(points), 4)
+        self.assertEqual(points[2].x, 4)
+        self.assertEqual(points[2].y, 5)
+        # The array keeps the geometry alive
+        del geometry
+        self.assertEqual(vertexes[3, 1], 7)
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testIndexData(self):
+        geometry = QSGGeometry(QSGGeometry.defaultAttributes_Point2D(), 4, 6)
+        indexes = geometry.indexDataNp()
+        self.assertEqual(indexes.shape, (6,))
+        self.assertEqual(indexes.dtype, np.uint16)
+        indexes[:] = [0, 1, 2, 2, 3, 0]
+        self.assertEqual(geometry.indexDataNp()[3], 2)
+
+        geometry = QSGGeometry(QSGGeometry.defaultAttributes_Point2D(), 4, 3,
+                               QSGGeometry.Type.UnsignedIntType.value)
+        indexes = geometry.indexDataNp()
+        self.assertEqual(indexes.shape, (3,))
+        self.assertEqual(indexes.dtype, np.uint32)
+
+
+if __name__ == '__main__':
+    unittest.main()
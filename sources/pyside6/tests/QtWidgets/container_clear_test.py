@@ -0,0 +1,71 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for releasing the items of containers in clear()'''
+
+import gc
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtWidgets import (QGraphicsRectItem, QGraphicsScene, QListWidget,
+                               QTreeWidget, QTreeWidgetItem)
+from helper.usesqapplication import UsesQApplication
+
+
+ITEM_COUNT = 200
+
+
+class ContainerClearTest(UsesQApplication):
+
+    def testListWidget(self):
+        listWidget = QListWidget()
+        for i in range(ITEM_COUNT):
+            listWidget.addItem(f"item{i}")
+        kept = [listWidget.item(i) for i in range(0, ITEM_COUNT, 10)]
+        listWidget.clear()
+        self.assertEqual(listWidget.count(), 0)
+        for item in kept:
+            self.assertRaises(RuntimeError, item.text)
+
+    def testGraphicsScene(self):
+        scene = QGraphicsScene()
+        kept = []
+        for i in range(ITEM_COUNT):
+            item = scene.addRect(0, 0, i, i)
+            if i % 10 == 0:
+                kept.append(item)
+        # An item with a child, both referenced from Python
+        parent = scene.addRect(0, 0, 1, 1)
+        child = QGraphicsRectItem(parent)
+        kept.extend((parent, child))
+        del item
+        scene.clear()
+        self.assertEqual(scene.items(), [])
+        for item in kept:
+            self.assertRaises(RuntimeError, item.rect)
+
+    def testTreeWidget(self):
+        tree = QTreeWidget()
+        for i in range(ITEM_COUNT // 10):
+            topLevelItem = QTreeWidgetItem(tree, [f"item{i}"])
+            for c in range(10):
+                QTreeWidgetItem(topLevelItem, [f"child{i}.{c}"])
+        del topLevelItem
+        tree.clear()
+        self.assertEqual(tree.topLevelItemCount(), 0)
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+        tree.addTopLevelItem(QTreeWidgetItem(["new"]))
+        self.assertEqual(tree.topLevelItemCount(), 1)
+        self.assertEqual(tree.topLevelItem(0).text(0), "new")
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -6,34 +6,140 @@ from __future__ import annotations
 Time a repeated Python run
 --------------------------
 
-Usage: python3 lazytiming.py              # uses PySide6
-       python3 lazytiming.py <any arg>    # uses PyQt6
+Usage: python3 lazytiming.py [options]
 
-It runs the same python for the testing.
+It runs the same python for the testing. Each run imports the modules and
+then touches a number of classes of them, which creates them when lazy
+loading is active.
 
-Actually comparing PySide6 and PyQt6 in action:
+Comparing the lazy loading options and PyQt6 in action:
 
-    PYSIDE6_OPTION_LAZY=0 python3 sources/pyside6/tests/manually/lazytiming.py      # normal
-    PYSIDE6_OPTION_LAZY=1 python3 sources/pyside6/tests/manually/lazytiming.py      # faster
-                          python3 sources/pyside6/tests/manually/lazytiming.py xxx  # PyQt
+    python3 sources/pyside6/tests/manually/lazytiming.py --lazy 0 1     # PySide6
+    python3 sources/pyside6/tests/manually/lazytiming.py --pyqt         # PyQt
+
+Touching classes measures the on-demand creation of types:
+
+    python3 sources/pyside6/tests/manually/lazytiming.py --touch 300
+
+Use --json to write the results and --compare to check a build against
+them. The script exits with status 1 when a median time exceeds the
+stored one by more than --tolerance percent, so it can run unattended:
+
+    python3 lazytiming.py --lazy 1 --touch 300 --json before.json
+    python3 lazytiming.py --lazy 1 --touch 300 --compare before.json
 """
+import argparse
+import json
+import os
+import statistics
 import subprocess
 import sys
 
 from timeit import default_timer as timer
 
-repeats = 100
-test1 = "PySide6"
-test2 = "PyQt6"
+# Run in the child process: Import the modules and touch the classes.
+CHILD_SCRIPT = """
+import sys
+from timeit import default_timer as timer
+start = timer()
+from {package} import {modules}
+modules = [{modules}]
+imported = timer()
+count = 0
+for module in modules:
+    for name in sorted(dir(module)):
+        if count >= {touch}:
+            break
+        if name.startswith("Q"):
+            getattr(module, name)
+            count += 1
+touched = timer()
+print(imported - start, touched - imported, count)
+"""
+
+
+def run_once(package, modules, touch, lazy):
+    script = CHILD_SCRIPT.format(package=package, modules=", ".join(modules), touch=touch)
+    env = os.environ.copy()
+    if lazy is not None:
+        env["PYSIDE6_OPTION_LAZY"] = str(lazy)
+    start = timer()
+    output = subprocess.check_output([sys.executable, "-c", script], env=env, text=True)
+    total = timer() - start
+    import_time, touch_time, count = output.split()
+    return total, float(import_time), float(touch_time), int(count)
+
+
+def measure(package, modules, touch, lazy, repeats):
+    run_once(package, modules, touch, lazy)    # warmup
+    runs = [run_once(package, modules, touch, lazy) for _ in range(repeats)]
+    totals, imports, touches, counts = zip(*runs)
+    return {"package": package, "lazy": lazy, "touched": counts[0],
+            "total": statistics.median(totals),
+            "import": statistics.median(imports),
+            "touch": statistics.median(touches)}
+
+
+def result_key(result):
+    return result["package"], result["lazy"], result["touched"]
+
+
+def compare(results, baseline_file, tolerance):
+    """Compares the results against the baseline results and returns
+       whether all median times are within the tolerance."""
+    with open(baseline_file) as f:
+        baseline = {result_key(result): result for result in json.load(f)}
+    ok = True
+    for result in results:
+        base = baseline.get(result_key(result))
+        if base is None:
+            print(f"  no baseline for {result_key(result)}")
+            continue
+        for phase in ("total", "import", "touch"):
+            if base[phase] <= 0:
+                continue
+            change = (result[phase] - base[phase]) * 100 / base[phase]
+            regressed = change > tolerance
+            marker = "  REGRESSION" if regressed else ""
+            print(f"  {phase:6} {base[phase]:.4f} -> {result[phase]:.4f} ({change:+.1f}%){marker}")
+            ok = ok and not regressed
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--repeats", type=int, default=100, help="Number of runs")
+    parser.add_argument("--modules", nargs="+", default=["QtCore", "QtGui", "QtWidgets"])
+    parser.add_argument("--touch", type=int, default=0,
+                        help="Number of classes to touch after the import")
+    parser.add_argument("--lazy", type=int, nargs="+", default=[None],
+                        help="Values of PYSIDE6_OPTION_LAZY to compare")
+    parser.add_argument("--pyqt", action="store_true", help="Use PyQt6")
+    parser.add_argument("--json", help="Write the results to a JSON file")
+    parser.add_argument("--compare", help="Compare the results to a JSON file")
+    parser.add_argument("--tolerance", type=float, default=10.0,
+                        help="Allowed slowdown in percent for --compare")
+    options = parser.parse_args()
+
+    package = "PyQt6" if options.pyqt else "PySide6"
+    lazy_values = [None] if options.pyqt else options.lazy
+    results = []
+    for lazy in lazy_values:
+        print(f"{options.repeats} * {package} (lazy={lazy})")
+        result = measure(package, options.modules, options.touch, lazy, options.repeats)
+        print(f"  time per run = {result['total']:.4f}   import = {result['import']:.4f}"
+              f"   touching {result['touched']} classes = {result['touch']:.4f}")
+        results.append(result)
+
+    if options.json:
+        with open(options.json, "w") as f:
+            json.dump(results, f, indent=4)
 
-test = test2 if sys.argv[1:] else test1
-cmd = [sys.executable, "-c", f"from {test} import QtCore, QtGui, QtWidgets"]
+    if options.compare and not compare(results, options.compare, options.tolerance):
+        return 1
+    return 0
 
-print(f"{repeats} * {test}")
 
-subprocess.call(cmd)        # warmup
-start_time = timer()
-for idx in range(repeats):
-    subprocess.call(cmd)
-stop_time = timer()
-print(f"time per run = {(stop_time - start_time) / repeats}")
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,56 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+from __future__ import annotations
+
+"""
+Time the conversion of QString return values to str
+---------------------------------------------------
+
+Usage: python3 qstringtiming.py [repeats]
+
+QDir.toNativeSeparators() returns its argument unchanged on Unix, so the
+timing is dominated by the str -> QString -> str conversion. The strings
+cover the PEP 393 kinds: ASCII, Latin-1, BMP and astral planes (surrogate
+pairs, which take the UTF-8 path).
+
+The baseline emulates the previous conversion via a UTF-8 encoded
+QByteArray by adding an encoding to and decoding from UTF-8 to each call.
+It slightly overestimates the previous cost since the direct conversion
+is still included.
+"""
+import sys
+
+from timeit import timeit
+
+samples = {
+    "ascii": "/usr/share/applications/some_application.desktop",
+    "latin-1": "/home/jürgen/Übersicht/café/naïve.txt",
+    "bmp": "/home/user/ドキュメント/Ελληνικά/Кириллица.txt",
+    "astral": "/home/user/emoji/\N{GRINNING FACE}\N{ROCKET}.txt",
+    "long ascii": "/usr/lib/x86_64-linux-gnu/" * 40,
+}
+
+
+def measure(function, repeats):
+    """Return the time per call in ns for each sample."""
+    result = {}
+    for name, value in samples.items():
+        elapsed = timeit(lambda: function(value), number=repeats)
+        result[name] = elapsed * 1e9 / repeats
+    return result
+
+
+if __name__ == "__main__":
+    from PySide6.QtCore import QDir
+
+    def utf8_round_trip(value):
+        return QDir.toNativeSeparators(value).encode("utf-8").decode("utf-8")
+
+    args = sys.argv[1:]
+    repeats = int(args[0]) if args else 200000
+    direct = measure(QDir.toNativeSeparators, repeats)
+    baseline = measure(utf8_round_trip, repeats)
+    print(f"{'':>12}  {'direct':>12}  {'utf-8 (old)':>12}")
+    for name in samples:
+        print(f"{name:>12}: {direct[name]:8.1f} ns  {baseline[name]:8.1f} ns"
+              f"  ({baseline[name] / direct[name]:.2f}x)")
@@ -43,6 +43,27 @@ class TestDisconnect(unittest.TestCase):
         self.assertFalse(self.called1)
         self.assertFalse(self.called2)
 
+    def testSenderDeletion(self):
+        """The connections of deleted senders are removed from the registry
+        of slot connections, so that new senders possibly reusing their
+        addresses are not affected by them."""
+        self.called1 = False
+        for i in range(20):
+            f = Foo()
+            f.bar.connect(self.theSlot1)
+            del f
+        self.assertFalse(self.called1)
+
+        f = Foo()
+        f.bar.connect(self.theSlot1)
+        f.bar.emit()
+        self.assertTrue(self.called1)
+
+        self.called1 = False
+        self.assertTrue(f.bar.disconnect(self.theSlot1))
+        f.bar.emit()
+        self.assertFalse(self.called1)
+
     def testDuringCallback(self):
         """ Test to see if the C++ object for a connection is accessed after the
         method returns.  This causes a segfault if the memory that was used by the
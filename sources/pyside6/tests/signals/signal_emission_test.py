@@ -163,5 +163,25 @@ class EmitEnum(UsesQApplication):
         self.assertEqual(self.arg, QProcess.NotRunning)
 
 
+class EmitMixedArguments(UsesQApplication):
+    """Test repeated emission of value and object type arguments"""
+
+    class MixedSender(QObject):
+        mixed = Signal(int, str, float, QObject)
+
+    def slot(self, *args):
+        self.args = args
+
+    def testIt(self):
+        self.args = None
+        sender = self.MixedSender()
+        sender.mixed.connect(self.slot)
+        for i in range(3):
+            sender.mixed.emit(i, f"text{i}", i / 2, sender)
+            self.assertEqual(self.args, (i, f"text{i}", i / 2, sender))
+        sender.mixed.emit(42, "", 0.0, None)
+        self.assertEqual(self.args, (42, "", 0.0, None))
+
+
 if __name__ == '__main__':
     unittest.main()
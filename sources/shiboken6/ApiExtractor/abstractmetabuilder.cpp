@@ -32,6 +32,7 @@
 #include "usingmember.h"
 
 #include "parser/codemodel.h"
+#include "parser/codemodelsnapshot.h"
 
 #include <clangparser/clangbuilder.h>
 #include <clangparser/clangutils.h>
@@ -39,6 +40,7 @@
 
 #include "qtcompat.h"
 
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
@@ -166,6 +168,11 @@ const QMultiHash<QString, QString> &AbstractMetaBuilder::typedefTargetToName() c
     return d->m_typedefTargetToName;
 }
 
+const QStringList &AbstractMetaBuilder::includedFiles() const
+{
+    return d->m_includedFiles;
+}
+
 void AbstractMetaBuilderPrivate::checkFunctionModifications() const
 {
     const auto &entries = TypeDatabase::instance()->entries();
@@ -450,7 +457,8 @@ void AbstractMetaBuilderPrivate::sortLists()
 FileModelItem AbstractMetaBuilderPrivate::buildDom(QByteArrayList arguments,
                                                    bool addCompilerSupportArguments,
                                                    LanguageLevel level,
-                                                   unsigned clangFlags)
+                                                   unsigned clangFlags,
+                                                   QStringList *includedFiles)
 {
     clang::Builder builder;
     builder.setForceProcessSystemIncludes(TypeDatabase::instance()->forceProcessSystemIncludes());
@@ -463,6 +471,8 @@ FileModelItem AbstractMetaBuilderPrivate::buildDom(QByteArrayList arguments,
     FileModelItem result = clang::parse(arguments, addCompilerSupportArguments,
                                         level, clangFlags, builder)
         ? builder.dom() : FileModelItem();
+    if (includedFiles != nullptr)
+        *includedFiles = builder.includedFiles();
     const clang::BaseVisitor::Diagnostics &diagnostics = builder.diagnostics();
     if (const auto diagnosticsCount = diagnostics.size()) {
         QDebug d = qWarning();
@@ -717,16 +727,86 @@ void AbstractMetaBuilderPrivate::traverseDom(const FileModelItem &dom,
     ReportHandler::endProgress();
 }
 
+// Key of a code model snapshot: everything influencing the parse apart from
+// the included files, which are checked separately. The main file is a
+// temporary file including the global headers; its contents are hashed.
+static QByteArray codeModelSnapshotKey(const QByteArrayList &arguments,
+                                       bool addCompilerSupportArguments,
+                                       LanguageLevel level, unsigned clangFlags)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(clang::libClangVersion().toString().toUtf8());
+    hash.addData(QByteArray::number(int(clang::compiler())) + ' '
+                 + QByteArray::number(int(clang::platform())) + ' '
+                 + clang::compilerPath().toUtf8());
+    hash.addData(QByteArray::number(addCompilerSupportArguments ? 1 : 0) + ' '
+                 + QByteArray::number(int(level)) + ' ' + QByteArray::number(clangFlags));
+    // System headers to be processed (typesystem and command line)
+    QStringList systemIncludes = TypeDatabase::instance()->forceProcessSystemIncludes();
+    systemIncludes.sort();
+    for (const auto &systemInclude : std::as_const(systemIncludes))
+        hash.addData(" -S" + systemInclude.toUtf8());
+    for (qsizetype i = 0, last = arguments.size() - 1; i < last; ++i)
+        hash.addData('\n' + arguments.at(i));
+    if (!arguments.isEmpty()) {
+        QFile mainFile(QFile::decodeName(arguments.constLast()));
+        if (mainFile.open(QIODevice::ReadOnly))
+            hash.addData('\n' + mainFile.readAll());
+    }
+    return hash.result().toHex();
+}
+
+FileModelItem AbstractMetaBuilderPrivate::loadCodeModelSnapshot(const QByteArray &key,
+                                                                CodeModel *model)
+{
+    QString errorMessage;
+    QStringList includedFiles;
+    auto result = CodeModelSnapshot::load(m_codeModelSnapshot, key, model,
+                                          &includedFiles, &errorMessage);
+    if (ReportHandler::isDebug(ReportHandler::SparseDebug)) {
+        if (result) {
+            qCInfo(lcShiboken).noquote().nospace() << "Loaded code model snapshot "
+                << QDir::toNativeSeparators(m_codeModelSnapshot);
+        } else if (QFileInfo::exists(m_codeModelSnapshot)) {
+            qCInfo(lcShiboken).noquote().nospace() << "Not using code model snapshot: "
+                << errorMessage;
+        }
+    }
+    if (result)
+        m_includedFiles = includedFiles;
+    return result;
+}
+
+void AbstractMetaBuilderPrivate::saveCodeModelSnapshot(const QByteArray &key,
+                                                       const FileModelItem &dom) const
+{
+    QString errorMessage;
+    if (!CodeModelSnapshot::save(m_codeModelSnapshot, key, m_includedFiles, dom, &errorMessage))
+        qCWarning(lcShiboken, "%s", qPrintable(errorMessage));
+}
+
 bool AbstractMetaBuilder::build(const QByteArrayList &arguments,
                                 ApiExtractorFlags apiExtractorFlags,
                                 bool addCompilerSupportArguments,
                                 LanguageLevel level,
                                 unsigned clangFlags)
 {
-    const FileModelItem dom = d->buildDom(arguments, addCompilerSupportArguments,
-                                          level, clangFlags);
-    if (!dom)
-        return false;
+    CodeModel snapshotModel;
+    QByteArray snapshotKey;
+    FileModelItem dom;
+    if (!d->m_codeModelSnapshot.isEmpty()) {
+        snapshotKey = codeModelSnapshotKey(arguments, addCompilerSupportArguments,
+                                           level, clangFlags);
+        dom = d->loadCodeModelSnapshot(snapshotKey, &snapshotModel);
+    }
+    if (!dom) {
+        dom = d->buildDom(arguments, addCompilerSupportArguments,
+                          level, clangFlags, &d->m_includedFiles);
+        if (!dom)
+            return false;
+        if (!snapshotKey.isEmpty())
+            d->saveCodeModelSnapshot(snapshotKey, dom);
+    }
     if (ReportHandler::isDebug(ReportHandler::MediumDebug))
         qCDebug(lcShiboken) << dom.get();
     d->traverseDom(dom, apiExtractorFlags);
@@ -3666,6 +3746,11 @@ void AbstractMetaBuilder::setUseGlobalHeader(bool h)
     AbstractMetaBuilderPrivate::m_useGlobalHeader = h;
 }
 
+void AbstractMetaBuilder::setCodeModelSnapshot(const QString &fileName)
+{
+    d->m_codeModelSnapshot = fileName;
+}
+
 void AbstractMetaBuilder::setSkipDeprecated(bool value)
 {
     d->m_skipDeprecated = value;
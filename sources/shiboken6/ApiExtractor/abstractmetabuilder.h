@@ -55,6 +55,8 @@ public:
     const AbstractMetaEnumList &globalEnums() const;
     const QHash<TypeEntryCPtr, AbstractMetaEnum> &typeEntryToEnumsHash() const;
     const QMultiHash<QString, QString> &typedefTargetToName() const;
+    /// Headers included by the parsed translation unit
+    const QStringList &includedFiles() const;
 
     bool build(const QByteArrayList &arguments,
                ApiExtractorFlags apiExtractorFlags = {},
@@ -74,6 +76,9 @@ public:
     static void setUseGlobalHeader(bool h);
 
     void setSkipDeprecated(bool value);
+    /// Load the code model from a snapshot file instead of parsing when the
+    /// parser arguments and the included files are unchanged, else update it.
+    void setCodeModelSnapshot(const QString &fileName);
 
     void setApiExtractorFlags(ApiExtractorFlags flags);
 
@@ -53,7 +53,10 @@ public:
     static FileModelItem buildDom(QByteArrayList arguments,
                                   bool addCompilerSupportArguments,
                                   LanguageLevel level,
-                                  unsigned clangFlags);
+                                  unsigned clangFlags,
+                                  QStringList *includedFiles = nullptr);
+    FileModelItem loadCodeModelSnapshot(const QByteArray &key, CodeModel *model);
+    void saveCodeModelSnapshot(const QByteArray &key, const FileModelItem &dom) const;
     void traverseDom(const FileModelItem &dom, ApiExtractorFlags flags);
 
     void dumpLog() const;
@@ -244,6 +247,8 @@ public:
 
     QString m_logDirectory;
     QFileInfoList m_globalHeaders;
+    QStringList m_includedFiles;
+    QString m_codeModelSnapshot;
     QStringList m_headerPaths;
     mutable QHash<QString, Include> m_resolveIncludeHash;
     QMultiHash<QString, QString> m_typedefTargetToName;
@@ -26,9 +26,11 @@
 #include "qtcompat.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
 
 #include <algorithm>
+#include <list>
 
 using namespace Qt::StringLiterals;
 
@@ -40,7 +42,14 @@ struct ModificationCacheEntry
      FunctionModificationList modifications;
 };
 
-using ModificationCache = QList<ModificationCacheEntry>;
+// std::list since references to the entries are returned while other
+// threads may append entries.
+using ModificationCache = std::list<ModificationCacheEntry>;
+
+// Guards the lazily computed data (signatures, modifications) since
+// classes can be generated concurrently. The values are computed without
+// holding the lock as this may recurse.
+static QMutex cacheMutex;
 
 class AbstractMetaFunctionPrivate
 {
@@ -531,28 +540,35 @@ bool AbstractMetaFunction::isWhiteListed() const
 
 QString AbstractMetaFunctionPrivate::signature() const
 {
-    if (m_cachedSignature.isEmpty()) {
-        m_cachedSignature = m_originalName;
-
-        m_cachedSignature += u'(';
-
-        for (qsizetype i = 0; i < m_arguments.size(); ++i) {
-            const AbstractMetaArgument &a = m_arguments.at(i);
-            const AbstractMetaType &t = a.type();
-            if (i > 0)
-                m_cachedSignature += u", "_s;
-            m_cachedSignature += t.cppSignature();
-            // We need to have the argument names in the qdoc files
-            if (!m_cachedSignature.endsWith(u'*') && !m_cachedSignature.endsWith(u'&'))
-                m_cachedSignature += u' ';
-            m_cachedSignature += a.name();
-        }
-        m_cachedSignature += u')';
+    {
+        QMutexLocker locker(&cacheMutex);
+        if (!m_cachedSignature.isEmpty())
+            return m_cachedSignature;
+    }
 
-        if (m_constant)
-            m_cachedSignature += u" const"_s;
+    QString result = m_originalName;
+
+    result += u'(';
+
+    for (qsizetype i = 0; i < m_arguments.size(); ++i) {
+        const AbstractMetaArgument &a = m_arguments.at(i);
+        const AbstractMetaType &t = a.type();
+        if (i > 0)
+            result += u", "_s;
+        result += t.cppSignature();
+        // We need to have the argument names in the qdoc files
+        if (!result.endsWith(u'*') && !result.endsWith(u'&'))
+            result += u' ';
+        result += a.name();
     }
-    return m_cachedSignature;
+    result += u')';
+
+    if (m_constant)
+        result += u" const"_s;
+
+    QMutexLocker locker(&cacheMutex);
+    m_cachedSignature = result;
+    return result;
 }
 
 QString AbstractMetaFunction::signature() const
@@ -1026,9 +1042,15 @@ QString AbstractMetaFunctionPrivate::formatMinimalSignature(const AbstractMetaFu
 
 QString AbstractMetaFunction::minimalSignature() const
 {
-    if (d->m_cachedMinimalSignature.isEmpty())
-        d->m_cachedMinimalSignature = d->formatMinimalSignature(this, false);
-    return d->m_cachedMinimalSignature;
+    {
+        QMutexLocker locker(&cacheMutex);
+        if (!d->m_cachedMinimalSignature.isEmpty())
+            return d->m_cachedMinimalSignature;
+    }
+    const QString result = d->formatMinimalSignature(this, false);
+    QMutexLocker locker(&cacheMutex);
+    d->m_cachedMinimalSignature = result;
+    return result;
 }
 
 QStringList AbstractMetaFunction::modificationSignatures() const
@@ -1090,16 +1112,27 @@ const FunctionModificationList &
 {
     if (m_addedFunction)
         return m_addedFunction->modifications();
-    for (const auto &ce : m_modificationCache) {
-        if (ce.klass == implementor)
-            return ce.modifications;
+    auto findEntry = [this, &implementor]() -> const FunctionModificationList * {
+        for (const auto &ce : m_modificationCache) {
+            if (ce.klass == implementor)
+                return &ce.modifications;
+        }
+        return nullptr;
+    };
+    {
+        QMutexLocker locker(&cacheMutex);
+        if (const auto *modifications = findEntry())
+            return *modifications;
     }
     auto modifications = m_class == nullptr
         ? AbstractMetaFunction::findGlobalModifications(q)
         : AbstractMetaFunction::findClassModifications(q, implementor);
 
-    m_modificationCache.append({implementor, modifications});
-    return m_modificationCache.constLast().modifications;
+    QMutexLocker locker(&cacheMutex);
+    if (const auto *existing = findEntry()) // Added by another thread
+        return *existing;
+    m_modificationCache.push_back({implementor, modifications});
+    return m_modificationCache.back().modifications;
 }
 
 const FunctionModificationList &
@@ -1112,6 +1145,7 @@ const FunctionModificationList &
 
 void AbstractMetaFunction::clearModificationsCache()
 {
+    QMutexLocker locker(&cacheMutex);
     d->m_modificationCache.clear();
 }
 
@@ -1420,17 +1454,23 @@ bool AbstractMetaFunction::isVirtual() const
 
 QString AbstractMetaFunctionPrivate::modifiedName(const AbstractMetaFunction *q) const
 {
-    if (m_cachedModifiedName.isEmpty()) {
-        for (const auto &mod : q->modifications(q->implementingClass())) {
-            if (mod.isRenameModifier()) {
-                m_cachedModifiedName = mod.renamedToName();
-                break;
-            }
+    {
+        QMutexLocker locker(&cacheMutex);
+        if (!m_cachedModifiedName.isEmpty())
+            return m_cachedModifiedName;
+    }
+    QString result;
+    for (const auto &mod : q->modifications(q->implementingClass())) {
+        if (mod.isRenameModifier()) {
+            result = mod.renamedToName();
+            break;
         }
-        if (m_cachedModifiedName.isEmpty())
-            m_cachedModifiedName = m_name;
     }
-    return m_cachedModifiedName;
+    if (result.isEmpty())
+        result = m_name;
+    QMutexLocker locker(&cacheMutex);
+    m_cachedModifiedName = result;
+    return result;
 }
 
 QString AbstractMetaFunction::modifiedName() const
@@ -1499,16 +1539,21 @@ void AbstractMetaFunction::setExceptionHandlingModification(TypeSystem::Exceptio
 
 int AbstractMetaFunctionPrivate::overloadNumber(const AbstractMetaFunction *q) const
 {
-    if (m_cachedOverloadNumber == TypeSystem::OverloadNumberUnset) {
-        m_cachedOverloadNumber = TypeSystem::OverloadNumberDefault;
-        for (const auto &mod : q->modifications(q->implementingClass())) {
-            if (mod.overloadNumber() != TypeSystem::OverloadNumberUnset) {
-                m_cachedOverloadNumber = mod.overloadNumber();
-                break;
-            }
+    {
+        QMutexLocker locker(&cacheMutex);
+        if (m_cachedOverloadNumber != TypeSystem::OverloadNumberUnset)
+            return m_cachedOverloadNumber;
+    }
+    int result = TypeSystem::OverloadNumberDefault;
+    for (const auto &mod : q->modifications(q->implementingClass())) {
+        if (mod.overloadNumber() != TypeSystem::OverloadNumberUnset) {
+            result = mod.overloadNumber();
+            break;
         }
     }
-    return m_cachedOverloadNumber;
+    QMutexLocker locker(&cacheMutex);
+    m_cachedOverloadNumber = result;
+    return result;
 }
 
 int AbstractMetaFunction::overloadNumber() const
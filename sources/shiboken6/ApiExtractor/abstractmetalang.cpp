@@ -24,6 +24,7 @@
 #include "qtcompat.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 
 #include <algorithm>
 
@@ -52,8 +53,7 @@ public:
           m_hasVirtualDestructor(false),
           m_isTypeDef(false),
           m_hasToStringCapability(false),
-          m_valueTypeWithCopyConstructorOnly(false),
-          m_hasCachedWrapper(false)
+          m_valueTypeWithCopyConstructorOnly(false)
     {
     }
 
@@ -90,7 +90,6 @@ public:
     uint m_isTypeDef : 1;
     uint m_hasToStringCapability : 1;
     uint m_valueTypeWithCopyConstructorOnly : 1;
-    mutable uint m_hasCachedWrapper : 1;
 
     Documentation m_doc;
 
@@ -117,6 +116,9 @@ public:
     SourceLocation m_sourceLocation;
     UsingMembers m_usingMembers;
 
+    // Not a bit field since it is set while other threads generating
+    // classes read the flags.
+    mutable bool m_hasCachedWrapper = false;
     mutable AbstractMetaClass::CppWrapper m_cachedWrapper;
     AbstractMetaClass::Attributes m_attributes;
 
@@ -1119,13 +1121,21 @@ static AbstractMetaClass::CppWrapper determineCppWrapper(const AbstractMetaClass
     return result;
 }
 
+// Guards the cached wrapper since classes can be generated concurrently.
+static QMutex cppWrapperMutex;
+
 AbstractMetaClass::CppWrapper AbstractMetaClass::cppWrapper() const
 {
-    if (!d->m_hasCachedWrapper) {
-        d->m_cachedWrapper = determineCppWrapper(this);
-        d->m_hasCachedWrapper = true;
+    {
+        QMutexLocker locker(&cppWrapperMutex);
+        if (d->m_hasCachedWrapper)
+            return d->m_cachedWrapper;
     }
-    return d->m_cachedWrapper;
+    const auto result = determineCppWrapper(this);
+    QMutexLocker locker(&cppWrapperMutex);
+    d->m_cachedWrapper = result;
+    d->m_hasCachedWrapper = true;
+    return result;
 }
 
 const UsingMembers &AbstractMetaClass::usingMembers() const
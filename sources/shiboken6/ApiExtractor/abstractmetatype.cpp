@@ -18,6 +18,7 @@
 #endif
 
 #include <QtCore/QHash>
+#include <QtCore/QRecursiveMutex>
 #include <QtCore/QSharedData>
 #include <QtCore/QStack>
 
@@ -53,55 +54,43 @@ const QSet<QString> &AbstractMetaType::cppCharTypes()
 
 const QSet<QString> &AbstractMetaType::cppSignedIntTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result = {u"char"_s, u"signed char"_s, u"short"_s, u"short int"_s,
-                  u"signed short"_s, u"signed short int"_s,
-                  u"int"_s, u"signed int"_s,
-                  u"long"_s, u"long int"_s,
-                  u"signed long"_s, u"signed long int"_s,
-                  u"long long"_s, u"long long int"_s,
-                  u"signed long long int"_s,
-                  u"ptrdiff_t"_s};
-        result |= cppSignedCharTypes();
-    }
+    static const QSet<QString> result =
+        QSet<QString>{u"char"_s, u"signed char"_s, u"short"_s, u"short int"_s,
+                      u"signed short"_s, u"signed short int"_s,
+                      u"int"_s, u"signed int"_s,
+                      u"long"_s, u"long int"_s,
+                      u"signed long"_s, u"signed long int"_s,
+                      u"long long"_s, u"long long int"_s,
+                      u"signed long long int"_s,
+                      u"ptrdiff_t"_s}
+        | cppSignedCharTypes();
     return result;
 }
 
 const QSet<QString> &AbstractMetaType::cppUnsignedIntTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result = {u"unsigned short"_s, u"unsigned short int"_s,
-                  u"unsigned"_s, u"unsigned int"_s,
-                  u"unsigned long"_s, u"unsigned long int"_s,
-                  u"unsigned long long"_s,
-                  u"unsigned long long int"_s,
-                  u"size_t"_s};
-        result |= cppUnsignedCharTypes();
-    }
+    static const QSet<QString> result =
+        QSet<QString>{u"unsigned short"_s, u"unsigned short int"_s,
+                      u"unsigned"_s, u"unsigned int"_s,
+                      u"unsigned long"_s, u"unsigned long int"_s,
+                      u"unsigned long long"_s,
+                      u"unsigned long long int"_s,
+                      u"size_t"_s}
+        | cppUnsignedCharTypes();
     return result;
 }
 
 const QSet<QString> &AbstractMetaType::cppIntegralTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result |= cppSignedIntTypes();
-        result |= cppUnsignedIntTypes();
-        result.insert(u"bool"_s);
-    }
+    static const QSet<QString> result =
+        cppSignedIntTypes() | cppUnsignedIntTypes() | QSet<QString>{u"bool"_s};
     return result;
 }
 
 const QSet<QString> &AbstractMetaType::cppPrimitiveTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result |= cppIntegralTypes();
-        result |= cppFloatTypes();
-        result.insert(u"wchar_t"_s);
-    }
+    static const QSet<QString> result =
+        cppIntegralTypes() | cppFloatTypes() | QSet<QString>{u"wchar_t"_s};
     return result;
 }
 
@@ -126,8 +115,6 @@ public:
 
     TypeEntryCPtr m_typeEntry;
     AbstractMetaTypeList m_instantiations;
-    mutable QString m_cachedCppSignature;
-    mutable QString m_cachedPythonSignature;
     QString m_originalTypeDescription;
 
     int m_arrayElementCount = -1;
@@ -139,8 +126,7 @@ public:
     AbstractMetaType::TypeUsagePattern m_pattern = AbstractMetaType::VoidPattern;
     uint m_constant : 1;
     uint m_volatile : 1;
-    uint m_signaturesDirty : 1;
-    uint m_reserved : 29; // unused
+    uint m_reserved : 30; // unused
 
     ReferenceType m_referenceType = NoReference;
     AbstractMetaTypeList m_children;
@@ -150,7 +136,6 @@ AbstractMetaTypeData::AbstractMetaTypeData(const TypeEntryCPtr &t) :
     m_typeEntry(t),
     m_constant(false),
     m_volatile(false),
-    m_signaturesDirty(true),
     m_reserved(0)
 {
 }
@@ -371,7 +356,6 @@ void AbstractMetaType::setReferenceType(ReferenceType ref)
 {
     if (d->m_referenceType != ref) {
         d->m_referenceType = ref;
-        d->m_signaturesDirty = true;
     }
 }
 
@@ -394,7 +378,6 @@ void AbstractMetaType::setIndirectionsV(const AbstractMetaType::Indirections &i)
 {
     if (d->m_indirections != i) {
         d->m_indirections = i;
-        d->m_signaturesDirty = true;
     }
 }
 
@@ -402,7 +385,6 @@ void AbstractMetaType::clearIndirections()
 {
     if (!d->m_indirections.isEmpty()) {
         d->m_indirections.clear();
-        d->m_signaturesDirty = true;
     }
 }
 
@@ -416,7 +398,6 @@ void AbstractMetaType::setIndirections(int indirections)
     const Indirections newValue(indirections, Indirection::Pointer);
     if (d->m_indirections != newValue) {
         d->m_indirections = newValue;
-        d->m_signaturesDirty = true;
     }
 }
 
@@ -429,7 +410,6 @@ void AbstractMetaType::setArrayElementCount(int n)
 {
     if (d->m_arrayElementCount != n) {
         d->m_arrayElementCount = n;
-        d->m_signaturesDirty = true;
     }
 }
 
@@ -447,7 +427,6 @@ void AbstractMetaType::setArrayElementType(const AbstractMetaType &t)
 {
     if (!d->m_arrayElementType || *d->m_arrayElementType != t) {
         d->m_arrayElementType.reset(new AbstractMetaType(t));
-        d->m_signaturesDirty = true;
     }
 }
 
@@ -464,20 +443,14 @@ AbstractMetaType AbstractMetaType::plainType() const
 
 QString AbstractMetaType::cppSignature() const
 {
-    const AbstractMetaTypeData *cd = d.constData();
-    if (cd->m_cachedCppSignature.isEmpty() || cd->m_signaturesDirty)
-        cd->m_cachedCppSignature = formatSignature(false);
-    return cd->m_cachedCppSignature;
+    return formatSignature(false);
 }
 
 QString AbstractMetaType::pythonSignature() const
 {
     // PYSIDE-921: Handle container returntypes correctly.
     // This is now a clean reimplementation.
-    const AbstractMetaTypeData *cd = d.constData();
-    if (cd->m_cachedPythonSignature.isEmpty() || cd->m_signaturesDirty)
-        cd->m_cachedPythonSignature = formatPythonSignature();
-    return cd->m_cachedPythonSignature;
+    return formatPythonSignature();
 }
 
 AbstractMetaType::TypeUsagePattern AbstractMetaTypeData::determineUsagePattern() const
@@ -728,7 +701,6 @@ void AbstractMetaType::setConstant(bool constant)
 {
     if (d->m_constant != constant) {
         d->m_constant = constant;
-        d->m_signaturesDirty = true;
     }
 }
 
@@ -741,7 +713,6 @@ void AbstractMetaType::setVolatile(bool v)
 {
     if (d->m_volatile != v) {
         d->m_volatile = v;
-        d->m_signaturesDirty = true;\
     }
 }
 
@@ -798,16 +769,19 @@ void AbstractMetaType::setViewOn(const AbstractMetaType &v)
         d->m_viewOn.reset(new AbstractMetaType(v));
 }
 
+static AbstractMetaType createVoidHelper()
+{
+    const TypeEntryCPtr voidTypeEntry = TypeDatabase::instance()->findType(u"void"_s);
+    Q_ASSERT(voidTypeEntry);
+    AbstractMetaType result(voidTypeEntry);
+    result.decideUsagePattern();
+    return result;
+}
+
 AbstractMetaType AbstractMetaType::createVoid()
 {
-    static QScopedPointer<AbstractMetaType> metaType;
-    if (metaType.isNull()) {
-        static TypeEntryCPtr voidTypeEntry = TypeDatabase::instance()->findType(u"void"_s);
-        Q_ASSERT(voidTypeEntry);
-        metaType.reset(new AbstractMetaType(voidTypeEntry));
-        metaType->decideUsagePattern();
-    }
-    return *metaType.data();
+    static const AbstractMetaType result = createVoidHelper();
+    return result;
 }
 
 void AbstractMetaType::dereference(QString *type)
@@ -946,9 +920,14 @@ using AbstractMetaTypeCache = QHash<QString, AbstractMetaType>;
 
 Q_GLOBAL_STATIC(AbstractMetaTypeCache, metaTypeFromStringCache)
 
+// Types are created from strings when generating classes concurrently.
+// Recursive since translating a type may instantiate templates.
+static QRecursiveMutex metaTypeFromStringMutex;
+
 std::optional<AbstractMetaType>
 AbstractMetaType::fromString(const QString &typeSignatureIn, QString *errorMessage)
 {
+    QMutexLocker locker(&metaTypeFromStringMutex);
     auto &cache = *metaTypeFromStringCache();
     auto it = cache.find(typeSignatureIn);
     if (it != cache.end())
@@ -979,6 +958,7 @@ AbstractMetaType AbstractMetaType::fromTypeEntry(const TypeEntryCPtr &typeEntry)
     QString typeName = typeEntry->qualifiedCppName();
     if (typeName.startsWith(u"::"))
         typeName.remove(0, 2);
+    QMutexLocker locker(&metaTypeFromStringMutex);
     auto &cache  = *metaTypeFromStringCache();
     auto it = cache.find(typeName);
     if (it != cache.end())
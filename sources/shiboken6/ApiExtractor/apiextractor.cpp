@@ -24,6 +24,8 @@
 #include "namespacetypeentry.h"
 #include "typesystemtypeentry.h"
 
+#include "clangparser/clangparser.h"
+
 #include "qtcompat.h"
 
 #include <QtCore/QDir>
@@ -49,6 +51,9 @@ struct ApiExtractorOptions
     QFileInfoList m_cppFileNames;
     HeaderPaths m_includePaths;
     QStringList m_clangOptions;
+    QString m_precompiledHeader;
+    QString m_precompiledHeaderDirectory;
+    QString m_codeModelSnapshot;
     QString m_logDirectory;
     LanguageLevel m_languageLevel = LanguageLevel::Default;
     bool m_skipDeprecated = false;
@@ -80,6 +85,12 @@ QList<OptionDescription> ApiExtractor::options()
          u"System include paths used by the C++ parser"_s},
         {u"language-level=, -std=<level>"_s,
          languageLevelDescription()},
+        {u"precompiled-header=<file>"_s,
+         u"Header including dependencies to be precompiled and reused by subsequent runs"_s},
+        {u"precompiled-header-directory=<dir>"_s,
+         u"Directory for the precompiled header (default: shiboken6/pch in the cache directory)"_s},
+        {u"code-model-snapshot=<file>"_s,
+         u"Snapshot file of the code model to be reused while the headers are unchanged"_s},
     };
 }
 
@@ -198,6 +209,18 @@ bool ApiExtractorOptionsParser::handleOption(const QString &key, const QString &
         setLanguageLevel(value);
         return true;
     }
+    if (key == u"precompiled-header") {
+        m_options->m_precompiledHeader = value;
+        return true;
+    }
+    if (key == u"precompiled-header-directory") {
+        m_options->m_precompiledHeaderDirectory = value;
+        return true;
+    }
+    if (key == u"code-model-snapshot") {
+        m_options->m_codeModelSnapshot = value;
+        return true;
+    }
 
     if (source == OptionSource::ProjectFile) {
         if (key == u"include-path") {
@@ -360,6 +383,7 @@ bool ApiExtractorPrivate::runHelper(ApiExtractorFlags flags)
     m_builder->setLogDirectory(m_logDirectory);
     m_builder->setGlobalHeaders(m_cppFileNames);
     m_builder->setSkipDeprecated(m_skipDeprecated);
+    m_builder->setCodeModelSnapshot(m_codeModelSnapshot);
     m_builder->setHeaderPaths(m_includePaths);
     m_builder->setApiExtractorFlags(flags);
 
@@ -390,6 +414,12 @@ bool ApiExtractorPrivate::runHelper(ApiExtractorFlags flags)
             << "\nclang arguments: " << arguments;
     }
 
+    if (!m_precompiledHeader.isEmpty()) {
+        const QString directory = m_precompiledHeaderDirectory.isEmpty()
+            ? clang::defaultPrecompiledHeaderDirectory() : m_precompiledHeaderDirectory;
+        clang::setPrecompiledHeader(m_precompiledHeader, directory);
+    }
+
     const bool result = m_builder->build(arguments, flags, addCompilerSupportArguments,
                                          m_languageLevel);
     if (!result)
@@ -437,6 +467,11 @@ QStringList ApiExtractor::clangOptions() const
     return d->m_clangOptions;
 }
 
+QStringList ApiExtractor::includedFiles() const
+{
+    return d->m_builder != nullptr ? d->m_builder->includedFiles() : QStringList{};
+}
+
 AbstractMetaFunctionPtr
     ApiExtractor::inheritTemplateFunction(const AbstractMetaFunctionCPtr &function,
                                           const AbstractMetaTypeList &templateTypes)
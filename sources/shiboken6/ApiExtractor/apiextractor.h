@@ -49,6 +49,8 @@ public:
     void setLogDirectory(const QString& logDir);
     LanguageLevel languageLevel() const;
     QStringList clangOptions() const;
+    /// Headers included by the parsed translation unit (available after run())
+    QStringList includedFiles() const;
 
     const AbstractMetaEnumList &globalEnums() const;
     const AbstractMetaFunctionCList &globalFunctions() const;
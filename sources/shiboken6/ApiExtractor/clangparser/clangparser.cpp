@@ -6,15 +6,22 @@
 #include "clangdebugutils.h"
 #include "compilersupport.h"
 
+#include <reporthandler.h>
+
 #include <QtCore/QByteArrayList>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
 #include <QtCore/QScopedArrayPointer>
+#include <QtCore/QStandardPaths>
 #include <QtCore/QString>
-#include <QLoggingCategory>
 
-Q_DECLARE_LOGGING_CATEGORY(lcShiboken)
+#include <algorithm>
 
 using namespace Qt::StringLiterals;
 
@@ -235,15 +242,13 @@ static QByteArray msgCreateTranslationUnit(const QByteArrayList &clangArgs, unsi
     return result;
 }
 
-static CXTranslationUnit createTranslationUnit(CXIndex index,
-                                               const QByteArrayList &args,
+// courtesy qdoc
+static constexpr unsigned defaultTranslationUnitFlags = CXTranslationUnit_Incomplete;
+
+static QByteArrayList translationUnitArguments(const QByteArrayList &args,
                                                bool addCompilerSupportArguments,
-                                               LanguageLevel level,
-                                               unsigned flags = 0)
+                                               LanguageLevel level)
 {
-    // courtesy qdoc
-    const unsigned defaultFlags = CXTranslationUnit_Incomplete;
-
     static const QByteArrayList defaultArgs = {
 #ifndef Q_OS_WIN
         "-fPIC",
@@ -264,13 +269,24 @@ static CXTranslationUnit createTranslationUnit(CXIndex index,
     }
     clangArgs += detectVulkan();
     clangArgs += args;
+    return clangArgs;
+}
+
+static CXTranslationUnit createTranslationUnit(CXIndex index,
+                                               const QByteArrayList &args,
+                                               bool addCompilerSupportArguments,
+                                               LanguageLevel level,
+                                               unsigned flags = 0)
+{
+    const QByteArrayList clangArgs = translationUnitArguments(args, addCompilerSupportArguments,
+                                                              level);
     QScopedArrayPointer<const char *> argv(byteArrayListToFlatArgV(clangArgs));
     qCDebug(lcShiboken).noquote().nospace() << msgCreateTranslationUnit(clangArgs, flags);
 
     CXTranslationUnit tu{};
     CXErrorCode err = clang_parseTranslationUnit2(index, nullptr, argv.data(),
                                                   clangArgs.size(), nullptr, 0,
-                                                  defaultFlags | flags, &tu);
+                                                  defaultTranslationUnitFlags | flags, &tu);
     if (err || !tu) {
         qWarning().noquote().nospace() << "Could not parse "
             << clangArgs.constLast().constData() << ", error code: " << err;
@@ -279,6 +295,255 @@ static CXTranslationUnit createTranslationUnit(CXIndex index,
     return tu;
 }
 
+static void inclusionCallback(CXFile includedFile, CXSourceLocation *, unsigned includeLength,
+                              CXClientData clientData)
+{
+    if (includeLength == 0) // Main file
+        return;
+    auto *bv = reinterpret_cast<BaseVisitor *>(clientData);
+    const QString fileName = bv->getFileName(includedFile);
+    if (!fileName.isEmpty())
+        bv->appendIncludedFile(fileName);
+}
+
+static QString precompiledHeaderSource;
+static QString precompiledHeaderDirectory;
+
+void setPrecompiledHeader(const QString &header, const QString &directory)
+{
+    precompiledHeaderSource = header;
+    precompiledHeaderDirectory = directory;
+}
+
+QString defaultPrecompiledHeaderDirectory()
+{
+    QString result = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    if (result.isEmpty())
+        result = QDir::tempPath();
+    return result + u"/shiboken6/pch"_s;
+}
+
+// The precompiled header is named by the header and the key, so that runs
+// with different options do not replace each other's file. The dependencies
+// are recorded in a file next to it, starting with the key and the
+// "<size> <mtime> <path>" line of the precompiled header it was written for,
+// followed by the lines of each file included by the header. The header is
+// rebuilt when any of them changed.
+static const char pchDependenciesHeader[] = "shiboken-pch-dependencies 1";
+
+static QString precompiledHeaderFile(const QByteArray &key)
+{
+    const QString name = QFileInfo(precompiledHeaderSource).baseName() + u'-'
+                         + QString::fromLatin1(key.left(16)) + u".pch"_s;
+    return QDir(precompiledHeaderDirectory).filePath(name);
+}
+
+static QString pchDependenciesFile(const QString &pchFile)
+{
+    return pchFile + u".deps"_s;
+}
+
+// Arguments for precompiling the header: the arguments with the main file
+// replaced by the header.
+static QByteArrayList precompiledHeaderArguments(QByteArrayList args)
+{
+    args.removeLast();
+    args << "-x" << "c++-header" << QFile::encodeName(precompiledHeaderSource);
+    return args;
+}
+
+static bool isIncludePathArgument(const QByteArray &arg)
+{
+    return arg.startsWith("-I") || arg.startsWith("-isystem") || arg.startsWith("-F")
+        || arg.startsWith("-iframework");
+}
+
+// The key of the libclang version, the flags and the compiler arguments
+// affecting the precompiled header. The include paths differ between the
+// modules; the files they resolve to are checked as dependencies.
+static QByteArray precompiledHeaderKey(const QByteArrayList &pchArgs,
+                                       bool addCompilerSupportArguments,
+                                       LanguageLevel level, unsigned flags)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(libClangVersion().toString().toUtf8());
+    hash.addData(' ' + QByteArray::number(defaultTranslationUnitFlags | flags));
+    const auto clangArgs = translationUnitArguments(pchArgs, addCompilerSupportArguments, level);
+    for (const auto &arg : clangArgs) {
+        if (!isIncludePathArgument(arg))
+            hash.addData('\n' + arg);
+    }
+    return hash.result().toHex();
+}
+
+static QByteArray dependencyLine(const QFileInfo &fi)
+{
+    return QByteArray::number(fi.size()) + ' '
+        + QByteArray::number(fi.lastModified().toMSecsSinceEpoch()) + ' '
+        + QFile::encodeName(fi.absoluteFilePath());
+}
+
+static void pchInclusionCallback(CXFile includedFile, CXSourceLocation *, unsigned,
+                                 CXClientData clientData)
+{
+    const QString fileName = getFileName(includedFile);
+    if (!fileName.isEmpty())
+        reinterpret_cast<QStringList *>(clientData)->append(fileName);
+}
+
+// Write the dependencies for the precompiled header. Since the dependency
+// file records the precompiled header it belongs to, a reader does not
+// accept it for a precompiled header replaced by another process meanwhile.
+static bool writePrecompiledHeaderDependencies(CXTranslationUnit tu, const QString &pchFile,
+                                               const QByteArray &key, QStringList *dependencies)
+{
+    dependencies->clear();
+    clang_getInclusions(tu, pchInclusionCallback, reinterpret_cast<CXClientData>(dependencies));
+    dependencies->sort();
+    dependencies->removeDuplicates();
+
+    QByteArray data = pchDependenciesHeader + "\nkey "_ba + key + "\npch "_ba
+                      + dependencyLine(QFileInfo(pchFile)) + '\n';
+    for (const auto &dependency : std::as_const(*dependencies))
+        data += dependencyLine(QFileInfo(dependency)) + '\n';
+
+    QSaveFile file(pchDependenciesFile(pchFile));
+    return file.open(QIODevice::WriteOnly) && file.write(data) != -1 && file.commit();
+}
+
+// Check the precompiled header against the recorded key and dependencies.
+static bool isPrecompiledHeaderUpToDate(const QString &pchFile, const QByteArray &key,
+                                        QStringList *dependencies)
+{
+    const QFileInfo pchFileInfo(pchFile);
+    if (!pchFileInfo.isFile())
+        return false;
+    QFile file(pchDependenciesFile(pchFile));
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    const QByteArrayList lines = file.readAll().split('\n');
+    if (lines.size() < 3 || lines.at(0) != pchDependenciesHeader
+        || lines.at(1) != "key " + key || lines.at(2) != "pch " + dependencyLine(pchFileInfo)) {
+        return false;
+    }
+    dependencies->clear();
+    for (qsizetype i = 3, size = lines.size(); i < size; ++i) {
+        const QByteArray &line = lines.at(i);
+        if (line.isEmpty())
+            continue;
+        const auto timeEnd = line.indexOf(' ', line.indexOf(' ') + 1);
+        if (timeEnd == -1)
+            return false;
+        const QFileInfo fi(QFile::decodeName(line.mid(timeEnd + 1)));
+        if (!fi.isFile() || dependencyLine(fi) != line)
+            return false;
+        dependencies->append(fi.absoluteFilePath());
+    }
+    return true;
+}
+
+// Precompile the header. The file is written under a temporary name and
+// renamed since other processes might be using it.
+static bool createPrecompiledHeader(CXIndex index, const QByteArrayList &pchArgs,
+                                    bool addCompilerSupportArguments,
+                                    LanguageLevel level, unsigned flags,
+                                    const QString &pchFile, const QByteArray &key,
+                                    QStringList *dependencies)
+{
+    PhaseTimer timer("clang: precompiled header");
+    CXTranslationUnit tu = createTranslationUnit(index, pchArgs, addCompilerSupportArguments,
+                                                 level, flags | CXTranslationUnit_ForSerialization);
+    if (!tu)
+        return false;
+
+    const QList<Diagnostic> diagnostics = getDiagnostics(tu);
+    bool ok = maxSeverity(diagnostics) < CXDiagnostic_Error;
+    if (ok) {
+        const QString tempFile = pchFile + u'.'
+                                 + QString::number(QCoreApplication::applicationPid());
+        ok = QDir().mkpath(QFileInfo(pchFile).absolutePath())
+             && clang_saveTranslationUnit(tu, QFile::encodeName(tempFile).constData(),
+                                          clang_defaultSaveOptions(tu)) == CXSaveError_None;
+        if (ok && !QFile::rename(tempFile, pchFile)) {
+            QFile::remove(pchFile);
+            ok = QFile::rename(tempFile, pchFile);
+        }
+        if (ok)
+            ok = writePrecompiledHeaderDependencies(tu, pchFile, key, dependencies);
+        if (!ok) {
+            QFile::remove(tempFile);
+            qCWarning(lcShiboken).noquote().nospace() << "Unable to write "
+                << QDir::toNativeSeparators(pchFile);
+        }
+    } else {
+        QDebug debug = qWarning();
+        debug.noquote();
+        debug.nospace();
+        debug << "Errors in precompiled header "
+            << QDir::toNativeSeparators(precompiledHeaderSource) << ":\n";
+        for (const Diagnostic &diagnostic : diagnostics)
+            debug << diagnostic << '\n';
+    }
+    clang_disposeTranslationUnit(tu);
+    return ok;
+}
+
+// Check for errors loading the precompiled header (for example, when it was
+// replaced by another process).
+static bool hasPrecompiledHeaderError(CXTranslationUnit tu, const QString &pchFile)
+{
+    const QString pchFileName = QFileInfo(pchFile).fileName();
+    const QList<Diagnostic> diagnostics = getDiagnostics(tu);
+    return std::any_of(diagnostics.cbegin(), diagnostics.cend(),
+                       [&pchFileName](const Diagnostic &d) {
+        return d.severity >= CXDiagnostic_Fatal
+            && (d.message.contains(pchFileName) || d.message.contains("precompiled header"_L1)
+                || d.message.contains("AST file"_L1));
+    });
+}
+
+// Create the translation unit using the precompiled header. The precompiled
+// header and the files included by the header are returned in dependencies
+// since clang_getInclusions() does not report them for the translation unit.
+static CXTranslationUnit createTranslationUnitWithPch(CXIndex index,
+                                                      const QByteArrayList &clangArgs,
+                                                      bool addCompilerSupportArguments,
+                                                      LanguageLevel level, unsigned flags,
+                                                      QStringList *dependencies)
+{
+    const QByteArrayList pchArgs = precompiledHeaderArguments(clangArgs);
+    const QByteArray key = precompiledHeaderKey(pchArgs, addCompilerSupportArguments,
+                                                level, flags);
+    const QString pchFile = precompiledHeaderFile(key);
+    if (!isPrecompiledHeaderUpToDate(pchFile, key, dependencies)
+        && !createPrecompiledHeader(index, pchArgs, addCompilerSupportArguments,
+                                    level, flags, pchFile, key, dependencies)) {
+        return nullptr;
+    }
+
+    QByteArrayList args = clangArgs;
+    args.insert(args.size() - 1, "-include-pch");
+    args.insert(args.size() - 1, QFile::encodeName(pchFile));
+    for (int attempt = 0; ; ++attempt) {
+        CXTranslationUnit tu = createTranslationUnit(index, args, addCompilerSupportArguments,
+                                                     level, flags);
+        if (tu != nullptr && !hasPrecompiledHeaderError(tu, pchFile)) {
+            dependencies->prepend(QFileInfo(pchFile).absoluteFilePath());
+            return tu;
+        }
+        if (tu == nullptr)
+            return nullptr;
+        clang_disposeTranslationUnit(tu);
+        if (attempt > 0
+            || !createPrecompiledHeader(index, pchArgs, addCompilerSupportArguments,
+                                        level, flags, pchFile, key, dependencies)) {
+            qCWarning(lcShiboken).noquote().nospace() << "Unable to use precompiled header "
+                << QDir::toNativeSeparators(pchFile);
+            return nullptr;
+        }
+    }
+}
+
 /* clangFlags are flags to clang_parseTranslationUnit2() such as
  * CXTranslationUnit_KeepGoing (from CINDEX_VERSION_MAJOR/CINDEX_VERSION_MINOR 0.35)
  */
@@ -293,15 +558,29 @@ bool parse(const QByteArrayList  &clangArgs, bool addCompilerSupportArguments,
         return false;
     }
 
-    CXTranslationUnit translationUnit =
-        createTranslationUnit(index, clangArgs, addCompilerSupportArguments,
-                              level, clangFlags);
+    CXTranslationUnit translationUnit = nullptr;
+    QStringList precompiledHeaderDependencies;
+    if (!precompiledHeaderSource.isEmpty()) {
+        translationUnit = createTranslationUnitWithPch(index, clangArgs,
+                                                       addCompilerSupportArguments,
+                                                       level, clangFlags,
+                                                       &precompiledHeaderDependencies);
+        if (translationUnit) {
+            for (const auto &dependency : std::as_const(precompiledHeaderDependencies))
+                bv.appendIncludedFile(dependency);
+        }
+    }
+    if (!translationUnit) {
+        translationUnit = createTranslationUnit(index, clangArgs, addCompilerSupportArguments,
+                                                level, clangFlags);
+    }
     if (!translationUnit)
         return false;
 
     CXCursor rootCursor = clang_getTranslationUnitCursor(translationUnit);
 
     clang_visitChildren(rootCursor, visitorCallback, reinterpret_cast<CXClientData>(&bv));
+    clang_getInclusions(translationUnit, inclusionCallback, reinterpret_cast<CXClientData>(&bv));
 
     QList<Diagnostic> diagnostics = getDiagnostics(translationUnit);
     diagnostics.append(bv.diagnostics());
@@ -9,6 +9,7 @@
 #include <QtCore/QByteArrayList>
 #include <QtCore/QHash>
 #include <QtCore/QString>
+#include <QtCore/QStringList>
 #include <QtCore/QList>
 
 #include <string_view>
@@ -69,16 +70,27 @@ public:
     void setDiagnostics(const Diagnostics &d);
     void appendDiagnostic(const Diagnostic &d);
 
+    // Files included by the translation unit, excluding the main file
+    QStringList includedFiles() const { return m_includedFiles; }
+    void appendIncludedFile(const QString &fileName) { m_includedFiles.append(fileName); }
+
     // For usage by the parser
     bool _handleVisitLocation( const CXSourceLocation &location);
 
 private:
     SourceFileCache m_fileCache;
     Diagnostics m_diagnostics;
+    QStringList m_includedFiles;
     CXFile m_currentCxFile{};
     bool m_visitCurrent = true;
 };
 
+// Set a header including the dependencies shared by several runs, for
+// example <QtCore/QtCore>. It is precompiled into directory, where it is
+// reused by subsequent runs passing the same options.
+void setPrecompiledHeader(const QString &header, const QString &directory);
+QString defaultPrecompiledHeaderDirectory();
+
 bool parse(const QByteArrayList  &clangArgs,
            bool addCompilerSupportArguments,
            LanguageLevel level, unsigned clangFlags, BaseVisitor &ctx);
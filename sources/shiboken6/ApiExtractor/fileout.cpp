@@ -6,14 +6,34 @@
 #include "reporthandler.h"
 #include "exception.h"
 
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QFileInfo>
 #include <QtCore/QDir>
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 
 #include <cstdio>
 
 bool FileOut::m_dryRun = false;
 bool FileOut::m_diff = false;
+bool FileOut::m_recording = false;
+
+static QMutex recordsMutex;
+static FileOut::Records recordList;
+
+static void addRecord(const QString &filePath, const QByteArray &buffer, FileOut::State state)
+{
+    FileOut::Record record{filePath, QCryptographicHash::hash(buffer, QCryptographicHash::Sha1),
+                           state};
+    QMutexLocker locker(&recordsMutex);
+    recordList.append(record);
+}
+
+FileOut::Records FileOut::records()
+{
+    QMutexLocker locker(&recordsMutex);
+    return recordList;
+}
 
 #ifdef Q_OS_LINUX
 static const char colorDelete[] = "\033[31m";
@@ -169,6 +189,8 @@ FileOut::State FileOut::done()
 
     if (fileEqual) {
         m_isDone = true;
+        if (m_recording)
+            addRecord(m_name, m_buffer, Unchanged);
         return Unchanged;
     }
 
@@ -193,6 +215,8 @@ FileOut::State FileOut::done()
     }
 
     m_isDone = true;
+    if (m_recording)
+        addRecord(m_name, m_buffer, Success);
 
     return Success;
 }
@@ -6,6 +6,8 @@
 
 #include "textstream.h"
 
+#include <QtCore/QList>
+
 class Exception;
 
 QT_FORWARD_DECLARE_CLASS(QFile)
@@ -18,6 +20,15 @@ public:
 
     enum State { Unchanged, Success };
 
+    /// Record of a finished file for the generator cache
+    struct Record
+    {
+        QString filePath;
+        QByteArray hash; // SHA-1 of the contents
+        State state;
+    };
+    using Records = QList<Record>;
+
     explicit FileOut(QString name);
     ~FileOut();
 
@@ -33,11 +44,17 @@ public:
     static bool dryRun() { return m_dryRun; }
     static void setDryRun(bool dryRun) { m_dryRun = dryRun; }
 
+    /// Record the finished files (thread-safe, see Generator::generate())
+    static bool recording() { return m_recording; }
+    static void setRecording(bool r) { m_recording = r; }
+    static Records records();
+
 private:
     QString m_name;
     bool m_isDone;
     static bool m_dryRun;
     static bool m_diff;
+    static bool m_recording;
 };
 
 #endif // FILEOUT_H
@@ -0,0 +1,674 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "codemodelsnapshot.h"
+#include "codemodel.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QSaveFile>
+
+using namespace Qt::StringLiterals;
+
+namespace CodeModelSnapshot
+{
+
+static constexpr quint32 magic = 0x53424b43; // "SBKC"
+static constexpr quint32 formatVersion = 2;  // Bump when the code model changes
+static constexpr auto streamVersion = QDataStream::Qt_6_0;
+static constexpr qint32 maxCount = 0x1000000;
+
+// Writes the items depth-first. Classes are numbered in the order of writing
+// for the references of base classes, which may point forward.
+class ModelWriter
+{
+public:
+    explicit ModelWriter(QDataStream &s) : m_stream(s) {}
+
+    void write(const FileModelItem &dom);
+
+private:
+    void numberClasses(const _ScopeModelItem *scope);
+    void numberClasses(const _NamespaceModelItem *nsp);
+
+    void writeCount(qsizetype c) { m_stream << qint32(c); }
+    void writeFileName(const QString &fileName);
+    void writeType(const TypeInfo &type);
+    void writeItem(const _CodeModelItem *item);
+    void writeScope(const _ScopeModelItem *scope);
+    void writeNamespace(const _NamespaceModelItem *nsp);
+    void writeClass(const _ClassModelItem *klass);
+    void writeTemplateParameters(const TemplateParameterList &parameters);
+    void writeMember(const _MemberModelItem *member);
+    void writeFunction(const _FunctionModelItem *function);
+    void writeEnum(const _EnumModelItem *e);
+    void writeTypeDef(const _TypeDefModelItem *typeDef);
+    void writeTemplateTypeAlias(const _TemplateTypeAliasModelItem *alias);
+
+    QDataStream &m_stream;
+    QHash<QString, qint32> m_fileNames;
+    QHash<const _ClassModelItem *, qint32> m_classIds;
+};
+
+void ModelWriter::numberClasses(const _ScopeModelItem *scope)
+{
+    for (const auto &klass : scope->classes()) {
+        m_classIds.insert(klass.get(), qint32(m_classIds.size()));
+        numberClasses(klass.get());
+    }
+}
+
+void ModelWriter::numberClasses(const _NamespaceModelItem *nsp)
+{
+    numberClasses(static_cast<const _ScopeModelItem *>(nsp));
+    for (const auto &nested : nsp->namespaces())
+        numberClasses(nested.get());
+}
+
+void ModelWriter::write(const FileModelItem &dom)
+{
+    numberClasses(dom.get());
+    writeNamespace(dom.get());
+}
+
+// File names are written once and referenced by index afterwards.
+void ModelWriter::writeFileName(const QString &fileName)
+{
+    auto it = m_fileNames.constFind(fileName);
+    if (it != m_fileNames.cend()) {
+        m_stream << it.value();
+        return;
+    }
+    const auto index = qint32(m_fileNames.size());
+    m_fileNames.insert(fileName, index);
+    m_stream << index << fileName;
+}
+
+void ModelWriter::writeType(const TypeInfo &type)
+{
+    m_stream << type.qualifiedName() << type.arrayElements();
+    const quint8 flags = (type.isConstant() ? 1 : 0) | (type.isVolatile() ? 2 : 0)
+                         | (type.isFunctionPointer() ? 4 : 0);
+    m_stream << flags << quint8(type.referenceType());
+    const auto &indirections = type.indirectionsV();
+    writeCount(indirections.size());
+    for (auto i : indirections)
+        m_stream << quint8(i);
+    writeCount(type.arguments().size());
+    for (const auto &a : type.arguments())
+        writeType(a);
+    writeCount(type.instantiations().size());
+    for (const auto &i : type.instantiations())
+        writeType(i);
+}
+
+void ModelWriter::writeItem(const _CodeModelItem *item)
+{
+    int startLine{};
+    int startColumn{};
+    int endLine{};
+    int endColumn{};
+    item->getStartPosition(&startLine, &startColumn);
+    item->getEndPosition(&endLine, &endColumn);
+    m_stream << item->name() << item->scope();
+    writeFileName(item->fileName());
+    m_stream << qint32(startLine) << qint32(startColumn) << qint32(endLine) << qint32(endColumn);
+}
+
+void ModelWriter::writeScope(const _ScopeModelItem *scope)
+{
+    writeItem(scope);
+    m_stream << scope->enumsDeclarations();
+    const auto classes = scope->classes();
+    writeCount(classes.size());
+    for (const auto &klass : classes)
+        writeClass(klass.get());
+    writeCount(scope->enums().size());
+    for (const auto &e : scope->enums())
+        writeEnum(e.get());
+    writeCount(scope->functions().size());
+    for (const auto &f : scope->functions())
+        writeFunction(f.get());
+    const auto typeDefs = scope->typeDefs();
+    writeCount(typeDefs.size());
+    for (const auto &t : typeDefs)
+        writeTypeDef(t.get());
+    const auto aliases = scope->templateTypeAliases();
+    writeCount(aliases.size());
+    for (const auto &a : aliases)
+        writeTemplateTypeAlias(a.get());
+    const auto variables = scope->variables();
+    writeCount(variables.size());
+    for (const auto &v : variables)
+        writeMember(v.get());
+}
+
+void ModelWriter::writeNamespace(const _NamespaceModelItem *nsp)
+{
+    // The type (anonymous, inline) precedes the contents
+    m_stream << quint8(nsp->type());
+    writeScope(nsp);
+    writeCount(nsp->namespaces().size());
+    for (const auto &nested : nsp->namespaces())
+        writeNamespace(nested.get());
+}
+
+void ModelWriter::writeClass(const _ClassModelItem *klass)
+{
+    writeScope(klass);
+    const auto &baseClasses = klass->baseClasses();
+    writeCount(baseClasses.size());
+    for (const auto &base : baseClasses) {
+        m_stream << base.name << (base.klass ? m_classIds.value(base.klass.get(), -1) : -1)
+            << quint8(base.accessPolicy);
+    }
+    const auto &usingMembers = klass->usingMembers();
+    writeCount(usingMembers.size());
+    for (const auto &u : usingMembers)
+        m_stream << u.className << u.memberName << quint8(u.access);
+    writeTemplateParameters(klass->templateParameters());
+    m_stream << quint8(klass->classType()) << klass->propertyDeclarations()
+        << klass->isFinal();
+}
+
+void ModelWriter::writeTemplateParameters(const TemplateParameterList &parameters)
+{
+    writeCount(parameters.size());
+    for (const auto &p : parameters) {
+        writeItem(p.get());
+        writeType(p->type());
+        m_stream << p->defaultValue();
+    }
+}
+
+void ModelWriter::writeMember(const _MemberModelItem *member)
+{
+    writeItem(member);
+    const quint8 flags = (member->isConstant() ? 0x1 : 0) | (member->isVolatile() ? 0x2 : 0)
+        | (member->isStatic() ? 0x4 : 0) | (member->isAuto() ? 0x8 : 0)
+        | (member->isFriend() ? 0x10 : 0) | (member->isRegister() ? 0x20 : 0)
+        | (member->isExtern() ? 0x40 : 0) | (member->isMutable() ? 0x80 : 0);
+    m_stream << flags << quint8(member->accessPolicy());
+    writeTemplateParameters(member->templateParameters());
+    writeType(member->type());
+}
+
+void ModelWriter::writeFunction(const _FunctionModelItem *function)
+{
+    writeMember(function);
+    const auto arguments = function->arguments();
+    writeCount(arguments.size());
+    for (const auto &a : arguments) {
+        writeItem(a.get());
+        writeType(a->type());
+        m_stream << a->defaultValue() << a->defaultValueExpression() << a->scopeResolution();
+    }
+    const quint8 flags = (function->isDeleted() ? 0x1 : 0) | (function->isInline() ? 0x2 : 0)
+        | (function->isHiddenFriend() ? 0x4 : 0) | (function->isVariadics() ? 0x8 : 0)
+        | (function->scopeResolution() ? 0x10 : 0);
+    m_stream << qint32(function->functionType()) << quint32(function->attributes().toInt())
+        << flags << quint8(function->exceptionSpecification());
+}
+
+void ModelWriter::writeEnum(const _EnumModelItem *e)
+{
+    writeItem(e);
+    m_stream << quint8(e->accessPolicy()) << quint8(e->enumKind()) << e->isDeprecated()
+        << e->isSigned() << e->underlyingType();
+    const auto enumerators = e->enumerators();
+    writeCount(enumerators.size());
+    for (const auto &enumerator : enumerators) {
+        writeItem(enumerator.get());
+        auto value = enumerator->value();
+        const auto type = value.type();
+        m_stream << enumerator->stringValue() << quint8(type)
+            << (type == EnumValue::Unsigned ? value.unsignedValue() : quint64(value.value()))
+            << enumerator->isDeprecated();
+    }
+}
+
+void ModelWriter::writeTypeDef(const _TypeDefModelItem *typeDef)
+{
+    writeItem(typeDef);
+    writeType(typeDef->type());
+}
+
+void ModelWriter::writeTemplateTypeAlias(const _TemplateTypeAliasModelItem *alias)
+{
+    writeItem(alias);
+    writeTemplateParameters(alias->templateParameters());
+    writeType(alias->type());
+}
+
+// Reads the items in the order of ModelWriter. Base classes are added after
+// all classes have been created.
+class ModelReader
+{
+public:
+    explicit ModelReader(QDataStream &s, CodeModel *model) : m_stream(s), m_model(model) {}
+
+    FileModelItem read();
+
+private:
+    struct PendingBaseClass
+    {
+        _ClassModelItem *klass;
+        QString name;
+        qint32 id;
+        Access access;
+    };
+
+    bool ok() const { return m_stream.status() == QDataStream::Ok; }
+    qint32 readCount();
+    template <class Enum>
+    Enum readEnumValue()
+    {
+        quint8 v{};
+        m_stream >> v;
+        return static_cast<Enum>(v);
+    }
+    QString readString();
+    QStringList readStringList();
+    bool readBool();
+
+    QString readFileName();
+    TypeInfo readType();
+    void readItem(_CodeModelItem *item);
+    void readScope(_ScopeModelItem *scope);
+    void readNamespace(_NamespaceModelItem *nsp);
+    ClassModelItem readClass();
+    TemplateParameterList readTemplateParameters();
+    void readMember(_MemberModelItem *member);
+    FunctionModelItem readFunction();
+    EnumModelItem readEnum();
+    TypeDefModelItem readTypeDef();
+    TemplateTypeAliasModelItem readTemplateTypeAlias();
+
+    QDataStream &m_stream;
+    CodeModel *m_model;
+    QStringList m_fileNames;
+    QList<ClassModelItem> m_classes;
+    QList<PendingBaseClass> m_baseClasses;
+};
+
+qint32 ModelReader::readCount()
+{
+    qint32 result{};
+    m_stream >> result;
+    if (!ok() || result < 0 || result > maxCount) {
+        m_stream.setStatus(QDataStream::ReadCorruptData);
+        return 0;
+    }
+    return result;
+}
+
+QString ModelReader::readString()
+{
+    QString result;
+    m_stream >> result;
+    return result;
+}
+
+QStringList ModelReader::readStringList()
+{
+    QStringList result;
+    m_stream >> result;
+    return result;
+}
+
+bool ModelReader::readBool()
+{
+    bool result{};
+    m_stream >> result;
+    return result;
+}
+
+QString ModelReader::readFileName()
+{
+    qint32 index{};
+    m_stream >> index;
+    if (index == m_fileNames.size()) {
+        m_fileNames.append(readString());
+    } else if (index < 0 || index > m_fileNames.size()) {
+        m_stream.setStatus(QDataStream::ReadCorruptData);
+        return {};
+    }
+    return m_fileNames.at(index);
+}
+
+TypeInfo ModelReader::readType()
+{
+    TypeInfo result;
+    result.setQualifiedName(readStringList());
+    result.setArrayElements(readStringList());
+    quint8 flags{};
+    m_stream >> flags;
+    result.setConstant((flags & 1) != 0);
+    result.setVolatile((flags & 2) != 0);
+    result.setFunctionPointer((flags & 4) != 0);
+    result.setReferenceType(readEnumValue<ReferenceType>());
+    for (auto i = readCount(); i > 0; --i)
+        result.addIndirection(readEnumValue<Indirection>());
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        result.addArgument(readType());
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        result.addInstantiation(readType());
+    return result;
+}
+
+void ModelReader::readItem(_CodeModelItem *item)
+{
+    item->setName(readString());
+    item->setScope(readStringList());
+    item->setFileName(readFileName());
+    qint32 startLine{};
+    qint32 startColumn{};
+    qint32 endLine{};
+    qint32 endColumn{};
+    m_stream >> startLine >> startColumn >> endLine >> endColumn;
+    item->setStartPosition(startLine, startColumn);
+    item->setEndPosition(endLine, endColumn);
+}
+
+void ModelReader::readScope(_ScopeModelItem *scope)
+{
+    readItem(scope);
+    for (const auto &d : readStringList())
+        scope->addEnumsDeclaration(d);
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        scope->addClass(readClass());
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        scope->addEnum(readEnum());
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        scope->addFunction(readFunction());
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        scope->addTypeDef(readTypeDef());
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        scope->addTemplateTypeAlias(readTemplateTypeAlias());
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto variable = std::make_shared<_VariableModelItem>(m_model, QString{});
+        readMember(variable.get());
+        scope->addVariable(variable);
+    }
+}
+
+void ModelReader::readNamespace(_NamespaceModelItem *nsp)
+{
+    const auto type = readEnumValue<NamespaceType>();
+    if (type != NamespaceType::Default && type != NamespaceType::Anonymous
+        && type != NamespaceType::Inline) {
+        m_stream.setStatus(QDataStream::ReadCorruptData);
+        return;
+    }
+    nsp->setType(type);
+    readScope(nsp);
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto nested = std::make_shared<_NamespaceModelItem>(m_model, QString{});
+        readNamespace(nested.get());
+        nsp->addNamespace(nested);
+    }
+}
+
+ClassModelItem ModelReader::readClass()
+{
+    auto result = std::make_shared<_ClassModelItem>(m_model, QString{});
+    m_classes.append(result);
+    readScope(result.get());
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        PendingBaseClass base{result.get(), readString(), -1, Access::Public};
+        m_stream >> base.id;
+        base.access = readEnumValue<Access>();
+        m_baseClasses.append(base);
+    }
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        const QString className = readString();
+        const QString memberName = readString();
+        result->addUsingMember(className, memberName, readEnumValue<Access>());
+    }
+    result->setTemplateParameters(readTemplateParameters());
+    result->setClassType(readEnumValue<CodeModel::ClassType>());
+    for (const auto &p : readStringList())
+        result->addPropertyDeclaration(p);
+    result->setFinal(readBool());
+    return result;
+}
+
+TemplateParameterList ModelReader::readTemplateParameters()
+{
+    TemplateParameterList result;
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto parameter = std::make_shared<_TemplateParameterModelItem>(m_model, QString{});
+        readItem(parameter.get());
+        parameter->setType(readType());
+        parameter->setDefaultValue(readBool());
+        result.append(parameter);
+    }
+    return result;
+}
+
+void ModelReader::readMember(_MemberModelItem *member)
+{
+    readItem(member);
+    quint8 flags{};
+    m_stream >> flags;
+    member->setConstant((flags & 0x1) != 0);
+    member->setVolatile((flags & 0x2) != 0);
+    member->setStatic((flags & 0x4) != 0);
+    member->setAuto((flags & 0x8) != 0);
+    member->setFriend((flags & 0x10) != 0);
+    member->setRegister((flags & 0x20) != 0);
+    member->setExtern((flags & 0x40) != 0);
+    member->setMutable((flags & 0x80) != 0);
+    member->setAccessPolicy(readEnumValue<Access>());
+    member->setTemplateParameters(readTemplateParameters());
+    member->setType(readType());
+}
+
+FunctionModelItem ModelReader::readFunction()
+{
+    auto result = std::make_shared<_FunctionModelItem>(m_model, QString{});
+    readMember(result.get());
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto argument = std::make_shared<_ArgumentModelItem>(m_model, QString{});
+        readItem(argument.get());
+        argument->setType(readType());
+        argument->setDefaultValue(readBool());
+        argument->setDefaultValueExpression(readString());
+        argument->setScopeResolution(readBool());
+        result->addArgument(argument);
+    }
+    qint32 functionType{};
+    quint32 attributes{};
+    quint8 flags{};
+    m_stream >> functionType >> attributes >> flags;
+    result->setFunctionType(static_cast<CodeModel::FunctionType>(functionType));
+    result->setAttributes(FunctionAttributes::fromInt(int(attributes)));
+    result->setDeleted((flags & 0x1) != 0);
+    result->setInline((flags & 0x2) != 0);
+    result->setHiddenFriend((flags & 0x4) != 0);
+    result->setVariadics((flags & 0x8) != 0);
+    result->setScopeResolution((flags & 0x10) != 0);
+    result->setExceptionSpecification(readEnumValue<ExceptionSpecification>());
+    return result;
+}
+
+EnumModelItem ModelReader::readEnum()
+{
+    auto result = std::make_shared<_EnumModelItem>(m_model, QString{});
+    readItem(result.get());
+    result->setAccessPolicy(readEnumValue<Access>());
+    result->setEnumKind(readEnumValue<EnumKind>());
+    result->setDeprecated(readBool());
+    result->setSigned(readBool());
+    result->setUnderlyingType(readString());
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto enumerator = std::make_shared<_EnumeratorModelItem>(m_model, QString{});
+        readItem(enumerator.get());
+        enumerator->setStringValue(readString());
+        const auto type = readEnumValue<EnumValue::Type>();
+        quint64 value{};
+        m_stream >> value;
+        EnumValue enumValue;
+        if (type == EnumValue::Unsigned)
+            enumValue.setUnsignedValue(value);
+        else
+            enumValue.setValue(qint64(value));
+        enumerator->setValue(enumValue);
+        enumerator->setDeprecated(readBool());
+        result->addEnumerator(enumerator);
+    }
+    return result;
+}
+
+TypeDefModelItem ModelReader::readTypeDef()
+{
+    auto result = std::make_shared<_TypeDefModelItem>(m_model, QString{});
+    readItem(result.get());
+    result->setType(readType());
+    return result;
+}
+
+TemplateTypeAliasModelItem ModelReader::readTemplateTypeAlias()
+{
+    auto result = std::make_shared<_TemplateTypeAliasModelItem>(m_model, QString{});
+    readItem(result.get());
+    for (const auto &p : readTemplateParameters())
+        result->addTemplateParameter(p);
+    result->setType(readType());
+    return result;
+}
+
+FileModelItem ModelReader::read()
+{
+    FileModelItem result(new _FileModelItem(m_model));
+    readNamespace(result.get());
+    if (!ok())
+        return {};
+    for (const auto &base : std::as_const(m_baseClasses)) {
+        if (base.id >= m_classes.size()) {
+            m_stream.setStatus(QDataStream::ReadCorruptData);
+            return {};
+        }
+        base.klass->addBaseClass({base.name, base.id >= 0 ? m_classes.at(base.id) : ClassModelItem{},
+                                  base.access});
+    }
+    return result;
+}
+
+void writeModel(QDataStream &s, const FileModelItem &dom)
+{
+    ModelWriter(s).write(dom);
+}
+
+FileModelItem readModel(QDataStream &s, CodeModel *model)
+{
+    return ModelReader(s, model).read();
+}
+
+// Included files are checked by size and time stamp first, falling back
+// to the SHA-1 of the contents.
+struct IncludedFile
+{
+    QString fileName;
+    qint64 size = -1;
+    qint64 lastModified = -1;
+    QByteArray hash;
+};
+
+static QByteArray fileHash(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return {};
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(&file);
+    return hash.result();
+}
+
+static bool isUnchanged(const IncludedFile &f)
+{
+    const QFileInfo fi(f.fileName);
+    if (!fi.isFile())
+        return false;
+    if (fi.size() == f.size && fi.lastModified().toMSecsSinceEpoch() == f.lastModified)
+        return true;
+    return fileHash(f.fileName) == f.hash;
+}
+
+bool save(const QString &fileName, const QByteArray &key,
+          const QStringList &includedFiles, const FileModelItem &dom,
+          QString *errorMessage)
+{
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        *errorMessage = u"Cannot open "_s + QDir::toNativeSeparators(fileName)
+            + u" for writing: "_s + file.errorString();
+        return false;
+    }
+    QDataStream s(&file);
+    s.setVersion(streamVersion);
+    s << magic << formatVersion << key << qint32(includedFiles.size());
+    for (const auto &includedFile : includedFiles) {
+        const QFileInfo fi(includedFile);
+        s << includedFile << fi.size() << fi.lastModified().toMSecsSinceEpoch()
+            << fileHash(includedFile);
+    }
+    writeModel(s, dom);
+    if (s.status() != QDataStream::Ok || !file.commit()) {
+        *errorMessage = u"Cannot write "_s + QDir::toNativeSeparators(fileName)
+            + u": "_s + file.errorString();
+        return false;
+    }
+    return true;
+}
+
+FileModelItem load(const QString &fileName, const QByteArray &key, CodeModel *model,
+                   QStringList *includedFiles, QString *errorMessage)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        *errorMessage = u"Cannot open "_s + QDir::toNativeSeparators(fileName)
+            + u": "_s + file.errorString();
+        return {};
+    }
+    QDataStream s(&file);
+    s.setVersion(streamVersion);
+    quint32 fileMagic{};
+    quint32 fileFormatVersion{};
+    QByteArray fileKey;
+    qint32 includedFileCount{};
+    s >> fileMagic >> fileFormatVersion >> fileKey >> includedFileCount;
+    if (s.status() != QDataStream::Ok || fileMagic != magic || fileFormatVersion != formatVersion
+        || includedFileCount < 0 || includedFileCount > maxCount) {
+        *errorMessage = QDir::toNativeSeparators(fileName) + u" is not a compatible snapshot"_s;
+        return {};
+    }
+    if (!key.isEmpty() && fileKey != key) {
+        *errorMessage = u"The parser arguments changed"_s;
+        return {};
+    }
+
+    includedFiles->clear();
+    includedFiles->reserve(includedFileCount);
+    for (qint32 i = 0; i < includedFileCount && s.status() == QDataStream::Ok; ++i) {
+        IncludedFile f;
+        s >> f.fileName >> f.size >> f.lastModified >> f.hash;
+        if (!key.isEmpty() && !isUnchanged(f)) {
+            *errorMessage = QDir::toNativeSeparators(f.fileName) + u" changed"_s;
+            return {};
+        }
+        includedFiles->append(f.fileName);
+    }
+
+    FileModelItem result = readModel(s, model);
+    if (!result)
+        *errorMessage = QDir::toNativeSeparators(fileName) + u" is corrupt"_s;
+    return result;
+}
+
+} // namespace CodeModelSnapshot
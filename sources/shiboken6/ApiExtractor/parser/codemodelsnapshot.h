@@ -0,0 +1,37 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef CODEMODELSNAPSHOT_H
+#define CODEMODELSNAPSHOT_H
+
+#include "codemodel_fwd.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+QT_FORWARD_DECLARE_CLASS(QDataStream)
+
+// Binary snapshot of the code model built from the headers of a module
+// (ApiExtractor option --code-model-snapshot). It records a key of the parser
+// arguments and the files included by the translation unit, and is loaded
+// instead of parsing the headers when none of them changed.
+namespace CodeModelSnapshot
+{
+
+void writeModel(QDataStream &s, const FileModelItem &dom);
+// Returns a null item if the stream is corrupt.
+FileModelItem readModel(QDataStream &s, CodeModel *model);
+
+bool save(const QString &fileName, const QByteArray &key,
+          const QStringList &includedFiles, const FileModelItem &dom,
+          QString *errorMessage);
+
+// Loads a snapshot if it matches the key and the included files are
+// unchanged. An empty key skips the checks (for inspecting snapshots).
+FileModelItem load(const QString &fileName, const QByteArray &key, CodeModel *model,
+                   QStringList *includedFiles, QString *errorMessage);
+
+} // namespace CodeModelSnapshot
+
+#endif // CODEMODELSNAPSHOT_H
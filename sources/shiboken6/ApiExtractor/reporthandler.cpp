@@ -7,7 +7,10 @@
 #include "qtcompat.h"
 
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+#include <QtCore/QRecursiveMutex>
 #include <QtCore/QSet>
+#include <algorithm>
 #include <cstring>
 #include <cstdarg>
 #include <cstdio>
@@ -36,6 +39,22 @@ static bool m_withinProgress = false;
 static QByteArray m_progressMessage;
 static int m_step_warning = 0;
 static QElapsedTimer m_timer;
+static bool m_timingsEnabled = false;
+
+struct PhaseTiming
+{
+    QByteArray phase;
+    qint64 wallTimeMs;
+    qint64 cpuTimeMs;
+};
+
+static QList<PhaseTiming> m_timings;
+
+// Messages may be output from the threads generating and writing files.
+static QRecursiveMutex m_mutex;
+
+// Messages of the current thread captured for later output.
+static thread_local ReportHandler::Messages *m_capturedMessages = nullptr;
 
 Q_LOGGING_CATEGORY(lcShiboken, "qt.shiboken")
 Q_LOGGING_CATEGORY(lcShibokenDoc, "qt.shiboken.doc")
@@ -100,8 +119,34 @@ void ReportHandler::setPrefix(const QString &p)
     m_prefix = p;
 }
 
+void ReportHandler::startCapture(Messages *messages)
+{
+    m_capturedMessages = messages;
+}
+
+void ReportHandler::endCapture()
+{
+    m_capturedMessages = nullptr;
+}
+
+void ReportHandler::outputMessages(const Messages &messages)
+{
+    for (const auto &message : messages) {
+        const char *category = message.category.isNull()
+            ? nullptr : message.category.constData();
+        const QMessageLogContext context(nullptr, 0, nullptr, category);
+        messageOutput(message.type, context, message.text);
+    }
+}
+
 void ReportHandler::messageOutput(QtMsgType type, const QMessageLogContext &context, const QString &text)
 {
+    if (m_capturedMessages != nullptr && type != QtFatalMsg) {
+        m_capturedMessages->append({type, QByteArray(context.category), text});
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
     // Check for file location separator added by SourceLocation
     auto fileLocationPos = text.indexOf(u":\t");
     if (type == QtWarningMsg) {
@@ -192,3 +237,54 @@ QByteArray ReportHandler::doneMessage()
         result += " (" + QByteArray::number(m_suppressedCount) + " known issues)";
     return  result;
 }
+
+bool ReportHandler::timingsEnabled()
+{
+    return m_timingsEnabled;
+}
+
+void ReportHandler::setTimingsEnabled(bool e)
+{
+    m_timingsEnabled = e;
+}
+
+void ReportHandler::addTiming(const QByteArray &phase, qint64 wallTimeMs, qint64 cpuTimeMs)
+{
+    QMutexLocker locker(&m_mutex);
+    auto it = std::find_if(m_timings.begin(), m_timings.end(),
+                           [&phase](const PhaseTiming &t) { return t.phase == phase; });
+    if (it != m_timings.end()) {
+        it->wallTimeMs += wallTimeMs;
+        it->cpuTimeMs += cpuTimeMs;
+    } else {
+        m_timings.append({phase, wallTimeMs, cpuTimeMs});
+    }
+}
+
+QByteArray ReportHandler::timingsMessage()
+{
+    QMutexLocker locker(&m_mutex);
+    QByteArray result = "Timings " + m_prefix.toUtf8() + " (wall/CPU):\n";
+    for (const auto &timing : std::as_const(m_timings)) {
+        result += "  " + timing.phase.leftJustified(40) + ' '
+            + QByteArray::number(timing.wallTimeMs).rightJustified(7) + "ms "
+            + QByteArray::number(timing.cpuTimeMs).rightJustified(7) + "ms\n";
+    }
+    return result;
+}
+
+PhaseTimer::PhaseTimer(QByteArray phase) : m_phase(std::move(phase))
+{
+    if (ReportHandler::timingsEnabled()) {
+        m_timer.start();
+        m_cpuStart = std::clock();
+    }
+}
+
+PhaseTimer::~PhaseTimer()
+{
+    if (m_timer.isValid()) {
+        const auto cpuTimeMs = qint64(std::clock() - m_cpuStart) * 1000 / CLOCKS_PER_SEC;
+        ReportHandler::addTiming(m_phase, m_timer.elapsed(), cpuTimeMs);
+    }
+}
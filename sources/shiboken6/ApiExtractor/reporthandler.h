@@ -4,9 +4,14 @@
 #ifndef REPORTHANDLER_H
 #define REPORTHANDLER_H
 
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QString>
 
+#include <ctime>
+
 Q_DECLARE_LOGGING_CATEGORY(lcShiboken)
 Q_DECLARE_LOGGING_CATEGORY(lcShibokenDoc)
 
@@ -39,8 +44,44 @@ public:
 
     static QByteArray doneMessage();
 
+    static bool timingsEnabled();
+    static void setTimingsEnabled(bool e);
+    static void addTiming(const QByteArray &phase, qint64 wallTimeMs, qint64 cpuTimeMs);
+    static QByteArray timingsMessage();
+
+    /// Message captured from a thread for output in a defined order
+    struct Message
+    {
+        QtMsgType type;
+        QByteArray category;
+        QString text;
+    };
+    using Messages = QList<Message>;
+
+    /// Captures the messages of the current thread instead of printing them
+    static void startCapture(Messages *messages);
+    static void endCapture();
+    /// Prints captured messages, applying warning suppression and counting
+    static void outputMessages(const Messages &messages);
+
 private:
     static void messageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg);
 };
 
+/// Records the wall-clock and CPU time (of all threads) of a phase for the
+/// --timings option.
+class PhaseTimer
+{
+public:
+    Q_DISABLE_COPY_MOVE(PhaseTimer)
+
+    explicit PhaseTimer(QByteArray phase);
+    ~PhaseTimer();
+
+private:
+    QByteArray m_phase;
+    QElapsedTimer m_timer;
+    std::clock_t m_cpuStart = 0;
+};
+
 #endif // REPORTHANDLER_H
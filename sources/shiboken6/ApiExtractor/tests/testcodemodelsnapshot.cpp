@@ -0,0 +1,176 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "testcodemodelsnapshot.h"
+#include <abstractmetabuilder_p.h>
+#include <reporthandler.h>
+#include <typedatabase.h>
+#include <parser/codemodel.h>
+#include <parser/codemodelsnapshot.h>
+
+#include <QtTest/QTest>
+#include <QtCore/QDataStream>
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTemporaryDir>
+
+using namespace Qt::StringLiterals;
+
+static const char headerCode[] = R"(
+namespace Outer {
+inline namespace V1 {
+enum class Option : unsigned { Zero, One = 1, Large = 0xffffffffu };
+}
+class Base
+{
+public:
+    virtual ~Base();
+    virtual int compute(int x, double factor = 2.5) const = 0;
+protected:
+    Base(const Base &) = delete;
+};
+template <class T, int N = 3>
+class Container : public Base
+{
+public:
+    using ValueType = T;
+    int compute(int x, double factor = 2.5) const override;
+    T data[N];
+    static const int count;
+};
+class Derived final : public Container<int>
+{
+public:
+    enum Flag { A = -1, B = 2 };
+    explicit Derived(int value) noexcept;
+    int value() const;
+    friend bool operator==(const Derived &, const Derived &);
+};
+typedef Container<double, 2> DoubleContainer;
+template <class T> using Alias = Container<T *>;
+void function(const char *text, ...);
+extern int variable;
+} // namespace Outer
+)";
+
+static bool writeFile(const QString &fileName, const QByteArray &contents)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+    file.write(contents);
+    return true;
+}
+
+static FileModelItem parse(const QString &mainFile, QStringList *includedFiles = nullptr)
+{
+    ReportHandler::setSilent(true);
+    TypeDatabase::instance(true);
+    return AbstractMetaBuilderPrivate::buildDom({QFile::encodeName(mainFile)}, true,
+                                                LanguageLevel::Default, 0, includedFiles);
+}
+
+static QString debugOutput(const FileModelItem &dom)
+{
+    QString result;
+    QDebug debug(&result);
+    debug.setVerbosity(3);
+    debug << dom.get();
+    return result;
+}
+
+// Check that a freshly parsed code model and a model read back from a
+// snapshot are identical.
+void TestCodeModelSnapshot::testRoundTrip()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString mainFile = dir.filePath(u"main.cpp"_s);
+    QVERIFY(writeFile(mainFile, headerCode));
+    const FileModelItem dom = parse(mainFile);
+    QVERIFY(dom);
+
+    QByteArray data;
+    {
+        QDataStream s(&data, QIODevice::WriteOnly);
+        CodeModelSnapshot::writeModel(s, dom);
+    }
+    CodeModel model;
+    QDataStream stream(data);
+    const FileModelItem readDom = CodeModelSnapshot::readModel(stream, &model);
+    QVERIFY(readDom);
+    QCOMPARE(debugOutput(readDom), debugOutput(dom));
+
+    const auto outer = readDom->findNamespace(u"Outer");
+    QVERIFY(outer);
+    const auto &namespaces = outer->namespaces();
+    QCOMPARE(namespaces.size(), 1);
+    QCOMPARE(namespaces.constFirst()->type(), NamespaceType::Inline);
+    // Base classes reference the classes of the read model
+    const auto derived = outer->findClass(u"Derived"_s);
+    QVERIFY(derived);
+    QVERIFY(derived->isFinal());
+    QCOMPARE(derived->baseClasses().size(), 1);
+    const auto &base = derived->baseClasses().constFirst();
+    const auto parsedDerived = dom->findNamespace(u"Outer")->findClass(u"Derived"_s);
+    QCOMPARE(base.name, parsedDerived->baseClasses().constFirst().name);
+    QVERIFY(base.klass);
+    QVERIFY(base.klass == outer->findClass(u"Container"_s));
+
+    QByteArray rewrittenData;
+    {
+        QDataStream s(&rewrittenData, QIODevice::WriteOnly);
+        CodeModelSnapshot::writeModel(s, readDom);
+    }
+    QCOMPARE(rewrittenData, data);
+
+    // Truncated data must be rejected
+    CodeModel truncatedModel;
+    QDataStream truncated(data.left(data.size() / 2));
+    QVERIFY(!CodeModelSnapshot::readModel(truncated, &truncatedModel));
+}
+
+// Check that a snapshot file is only loaded while the key and the included
+// files are unchanged.
+void TestCodeModelSnapshot::testIncludedFiles()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString header = dir.filePath(u"header.h"_s);
+    const QString mainFile = dir.filePath(u"main.cpp"_s);
+    QVERIFY(writeFile(header, headerCode));
+    QVERIFY(writeFile(mainFile, "#include \"header.h\"\n"_ba));
+    QStringList includedFiles;
+    const FileModelItem dom = parse(mainFile, &includedFiles);
+    QVERIFY(dom);
+    QCOMPARE(includedFiles.size(), 1);
+    QCOMPARE(QFileInfo(includedFiles.constFirst()).fileName(), u"header.h");
+
+    const QString snapshot = dir.filePath(u"snapshot.bin"_s);
+    const QByteArray key = "key"_ba;
+    QString errorMessage;
+    QVERIFY2(CodeModelSnapshot::save(snapshot, key, includedFiles, dom, &errorMessage),
+             qPrintable(errorMessage));
+
+    CodeModel model;
+    QStringList loadedIncludedFiles;
+    const FileModelItem loadedDom = CodeModelSnapshot::load(snapshot, key, &model,
+                                                            &loadedIncludedFiles,
+                                                            &errorMessage);
+    QVERIFY2(loadedDom, qPrintable(errorMessage));
+    QCOMPARE(loadedIncludedFiles, includedFiles);
+    QCOMPARE(debugOutput(loadedDom), debugOutput(dom));
+
+    CodeModel otherKeyModel;
+    QVERIFY(!CodeModelSnapshot::load(snapshot, "other"_ba, &otherKeyModel,
+                                     &loadedIncludedFiles, &errorMessage));
+
+    QVERIFY(writeFile(header, headerCode + "int added;\n"_ba));
+    CodeModel changedModel;
+    QVERIFY(!CodeModelSnapshot::load(snapshot, key, &changedModel,
+                                     &loadedIncludedFiles, &errorMessage));
+    QVERIFY(errorMessage.contains(u"changed"));
+}
+
+QTEST_APPLESS_MAIN(TestCodeModelSnapshot)
@@ -0,0 +1,17 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef TESTCODEMODELSNAPSHOT_H
+#define TESTCODEMODELSNAPSHOT_H
+
+#include <QtCore/QObject>
+
+class TestCodeModelSnapshot : public QObject
+{
+    Q_OBJECT
+private slots:
+    void testRoundTrip();
+    void testIncludedFiles();
+};
+
+#endif
@@ -36,6 +36,7 @@
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QList>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QVersionNumber>
 #include <QtCore/QXmlStreamReader>
@@ -278,6 +279,7 @@ struct TypeDatabasePrivate : public TypeDatabaseOptions
     QStringList m_requiredTargetImports;
 
     QHash<QString, bool> m_parsedTypesystemFiles;
+    QStringList m_inputFiles; // Snippet/entity files read by the parser
 
     QList<TypeRejection> m_rejections;
 };
@@ -332,25 +334,27 @@ struct IntTypeNormalizationEntry
 
 using IntTypeNormalizationEntries = QList<IntTypeNormalizationEntry>;
 
-static const IntTypeNormalizationEntries &intTypeNormalizationEntries()
+static IntTypeNormalizationEntries createIntTypeNormalizationEntries()
 {
-    static IntTypeNormalizationEntries result;
-    static bool firstTime = true;
-    if (firstTime) {
-        firstTime = false;
-        for (const auto &intType : {"char"_L1, "short"_L1, "int"_L1, "long"_L1}) {
-            if (!TypeDatabase::instance()->findType(u'u' + intType)) {
-                IntTypeNormalizationEntry entry;
-                entry.replacement = "unsigned "_L1 + intType;
-                entry.regex.setPattern("\\bu"_L1 + intType + "\\b"_L1);
-                Q_ASSERT(entry.regex.isValid());
-                result.append(entry);
-            }
+    IntTypeNormalizationEntries result;
+    for (const auto &intType : {"char"_L1, "short"_L1, "int"_L1, "long"_L1}) {
+        if (!TypeDatabase::instance()->findType(u'u' + intType)) {
+            IntTypeNormalizationEntry entry;
+            entry.replacement = "unsigned "_L1 + intType;
+            entry.regex.setPattern("\\bu"_L1 + intType + "\\b"_L1);
+            Q_ASSERT(entry.regex.isValid());
+            result.append(entry);
         }
     }
     return result;
 }
 
+static const IntTypeNormalizationEntries &intTypeNormalizationEntries()
+{
+    static const IntTypeNormalizationEntries result = createIntTypeNormalizationEntries();
+    return result;
+}
+
 // Normalization helpers
 enum CharCategory { Space, Identifier, Other };
 
@@ -963,6 +967,24 @@ QString TypeDatabase::modifiedTypesystemFilepath(const QString& tsFile, const QS
     return d->modifiedTypesystemFilepath(tsFile, currentPath);
 }
 
+void TypeDatabase::addInputFile(const QString &fileName)
+{
+    if (!d->m_inputFiles.contains(fileName))
+        d->m_inputFiles.append(fileName);
+}
+
+QStringList TypeDatabase::inputFiles() const
+{
+    QStringList result;
+    for (auto it = d->m_parsedTypesystemFiles.cbegin(), end = d->m_parsedTypesystemFiles.cend();
+         it != end; ++it) {
+        if (it.value())
+            result.append(it.key());
+    }
+    result += d->m_inputFiles;
+    return result;
+}
+
 void TypeDatabase::logUnmatched() const
 {
     for (auto &sw : d->m_suppressedWarnings) {
@@ -1327,6 +1349,9 @@ void TypeDatabase::setDropTypeEntries(const QStringList &dropTypeEntries)
     d->m_dropTypeEntries.sort();
 }
 
+// The indexes are computed on first use, which can happen in the threads
+// generating classes.
+static QMutex typeIndexMutex;
 static bool computeTypeIndexes = true;
 static int maxTypeIndex;
 
@@ -1374,12 +1399,15 @@ static void _computeTypeIndexes()
 
 void TypeEntry::setRevision(int r)
 {
-    if (setRevisionHelper(r))
+    if (setRevisionHelper(r)) {
+        QMutexLocker locker(&typeIndexMutex);
         computeTypeIndexes = true;
+    }
 }
 
 int TypeEntry::sbkIndex() const
 {
+    QMutexLocker locker(&typeIndexMutex);
     if (computeTypeIndexes)
         _computeTypeIndexes();
     return sbkIndexHelper();
@@ -1387,6 +1415,7 @@ int TypeEntry::sbkIndex() const
 
 int getMaxTypeIndex()
 {
+    QMutexLocker locker(&typeIndexMutex);
     if (computeTypeIndexes)
         _computeTypeIndexes();
     return maxTypeIndex;
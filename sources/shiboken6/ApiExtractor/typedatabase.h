@@ -190,6 +190,11 @@ public:
 
     QString modifiedTypesystemFilepath(const QString &tsFile, const QString &currentPath = QString()) const;
 
+    /// Records a file read by the type system parser (snippets, entities)
+    void addInputFile(const QString &fileName);
+    /// Returns the type system files parsed and the files read by them
+    QStringList inputFiles() const;
+
     void logUnmatched() const;
 
 #ifndef QT_NO_DEBUG_STREAM
@@ -34,10 +34,13 @@
 #include "qtcompat.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QSet>
 #include <QtCore/QVarLengthArray>
 
+#include <atomic>
+
 using namespace Qt::StringLiterals;
 
 static QString buildName(const QString &entryName, const TypeEntryCPtr &parent)
@@ -49,6 +52,44 @@ static QString buildName(const QString &entryName, const TypeEntryCPtr &parent)
 // Access private class as 'd', cf macro Q_D()
 #define S_D(Class) auto d = static_cast<Class##Private *>(d_func())
 
+// Name computed on first use. Classes can be generated concurrently, so
+// the name is computed once under a lock of its own and then read without
+// locking. Setting it is only done while parsing.
+class CachedName
+{
+public:
+    CachedName() = default;
+    CachedName(const CachedName &other) : m_value(other.m_value),
+        m_computed(other.m_computed.load(std::memory_order_acquire)) {}
+    CachedName &operator=(const CachedName &) = delete;
+
+    template <class Function>
+    QString value(Function compute) const
+    {
+        if (!m_computed.load(std::memory_order_acquire)) {
+            QMutexLocker locker(&m_mutex);
+            if (!m_computed.load(std::memory_order_relaxed)) {
+                m_value = compute();
+                m_computed.store(true, std::memory_order_release);
+            }
+        }
+        return m_value;
+    }
+
+    void setValue(const QString &value)
+    {
+        m_value = value;
+        m_computed.store(!value.isEmpty(), std::memory_order_release);
+    }
+
+    void clear() { setValue({}); }
+
+private:
+    mutable QString m_value;
+    mutable std::atomic<bool> m_computed{false};
+    mutable QMutex m_mutex;
+};
+
 class TypeEntryPrivate
 {
 public:
@@ -62,14 +103,15 @@ public:
     virtual ~TypeEntryPrivate() = default;
 
     QString shortName() const;
+    QString buildShortName() const;
 
     TypeEntryCPtr m_parent;
     QString m_name; // C++ fully qualified
-    mutable QString m_cachedShortName; // C++ excluding inline namespaces
+    CachedName m_cachedShortName; // C++ excluding inline namespaces
     QString m_entryName;
     QString m_targetLangPackage;
-    mutable QString m_cachedTargetLangName; // "Foo.Bar"
-    mutable QString m_cachedTargetLangEntryName; // "Bar"
+    CachedName m_cachedTargetLangName; // "Foo.Bar"
+    CachedName m_cachedTargetLangEntryName; // "Bar"
     IncludeList m_extraIncludes;
     Include m_include;
     QVersionNumber m_version;
@@ -325,29 +367,31 @@ QString TypeEntry::name() const
 // ("std::__1::shared_ptr" -> "std::shared_ptr"
 QString TypeEntryPrivate::shortName() const
 {
-    if (m_cachedShortName.isEmpty()) {
-        QVarLengthArray<TypeEntryCPtr > parents;
-        bool foundInlineNamespace = false;
-        for (auto p = m_parent; p != nullptr && p->type() != TypeEntry::TypeSystemType; p = p->parent()) {
-            if (p->type() == TypeEntry::NamespaceType
-                && std::static_pointer_cast<const NamespaceTypeEntry>(p)->isInlineNamespace()) {
-                foundInlineNamespace = true;
-            } else {
-                parents.append(p);
-            }
-        }
-        if (foundInlineNamespace) {
-            m_cachedShortName.reserve(m_name.size());
-            for (auto i = parents.size() - 1; i >= 0; --i) {
-                m_cachedShortName.append(parents.at(i)->entryName());
-                m_cachedShortName.append(u"::"_s);
-            }
-            m_cachedShortName.append(m_entryName);
+    return m_cachedShortName.value([this] { return buildShortName(); });
+}
+
+QString TypeEntryPrivate::buildShortName() const
+{
+    QVarLengthArray<TypeEntryCPtr > parents;
+    bool foundInlineNamespace = false;
+    for (auto p = m_parent; p != nullptr && p->type() != TypeEntry::TypeSystemType; p = p->parent()) {
+        if (p->type() == TypeEntry::NamespaceType
+            && std::static_pointer_cast<const NamespaceTypeEntry>(p)->isInlineNamespace()) {
+            foundInlineNamespace = true;
         } else {
-            m_cachedShortName = m_name;
+            parents.append(p);
         }
     }
-    return m_cachedShortName;
+    if (!foundInlineNamespace)
+        return m_name;
+    QString result;
+    result.reserve(m_name.size());
+    for (auto i = parents.size() - 1; i >= 0; --i) {
+        result.append(parents.at(i)->entryName());
+        result.append(u"::"_s);
+    }
+    result.append(m_entryName);
+    return result;
 }
 
 QString TypeEntry::shortName() const
@@ -418,14 +462,12 @@ QString TypeEntry::targetLangApiName() const
 
 QString TypeEntry::targetLangName() const
 {
-    if (m_d->m_cachedTargetLangName.isEmpty())
-        m_d->m_cachedTargetLangName = buildTargetLangName();
-    return m_d->m_cachedTargetLangName;
+    return m_d->m_cachedTargetLangName.value([this] { return buildTargetLangName(); });
 }
 
 void TypeEntry::setTargetLangName(const QString &n)
 {
-    m_d->m_cachedTargetLangName = n;
+    m_d->m_cachedTargetLangName.setValue(n);
 }
 
 QString TypeEntry::buildTargetLangName() const
@@ -510,13 +552,13 @@ TypeEntryPrivate *TypeEntry::d_func()
 
 QString TypeEntry::targetLangEntryName() const
 {
-    if (m_d->m_cachedTargetLangEntryName.isEmpty()) {
-        m_d->m_cachedTargetLangEntryName = targetLangName();
-        const auto lastDot = m_d->m_cachedTargetLangEntryName.lastIndexOf(u'.');
+    return m_d->m_cachedTargetLangEntryName.value([this] {
+        QString result = targetLangName();
+        const auto lastDot = result.lastIndexOf(u'.');
         if (lastDot != -1)
-            m_d->m_cachedTargetLangEntryName.remove(0, lastDot + 1);
-    }
-    return m_d->m_cachedTargetLangEntryName;
+            result.remove(0, lastDot + 1);
+        return result;
+    });
 }
 
 QString TypeEntry::targetLangPackage() const
@@ -616,6 +616,7 @@ QString TypeSystemEntityResolver::readFile(const QString &entityName, QString *e
         *errorMessage = msgCannotOpenForReading(file);
         return {};
     }
+    TypeDatabase::instance()->addInputFile(path);
     QString result = QString::fromUtf8(file.readAll()).trimmed();
     // Remove license header comments on which QXmlStreamReader chokes
     if (result.startsWith(u"<!--")) {
@@ -1144,6 +1145,7 @@ bool TypeSystemParser::importFileElement(const QXmlStreamAttributes &atts)
             return false;
         }
     }
+    m_context->db->addInputFile(file.fileName());
 
     const auto quoteFrom = atts.value(quoteAfterLineAttribute);
     bool foundFromOk = quoteFrom.isEmpty();
@@ -2315,6 +2317,7 @@ bool TypeSystemParser::parseCustomConversion(const ConditionalStreamReader &,
                 m_error = msgCannotOpenForReading(conversionSource);
                 return false;
             }
+            m_context->db->addInputFile(sourceFile);
             const auto conversionRuleOptional =
                 extractSnippet(QString::fromUtf8(conversionSource.readAll()), snippetLabel);
             if (!conversionRuleOptional.has_value()) {
@@ -3035,6 +3038,7 @@ std::optional<TypeSystemParser::Snippet>
         m_error = msgCannotOpenForReading(codeFile);
         return std::nullopt;
     }
+    m_context->db->addInputFile(resolved);
     const auto contentOptional = extractSnippet(QString::fromUtf8(codeFile.readAll()),
                                                 result.snippetLabel);
     codeFile.close();
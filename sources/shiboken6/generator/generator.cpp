@@ -27,18 +27,26 @@
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThreadPool>
+
+#include <exception>
+#include <memory>
+#include <utility>
 
 using namespace Qt::StringLiterals;
 
 static constexpr auto ENABLE_PYSIDE_EXTENSIONS = "enable-pyside-extensions"_L1;
 static constexpr auto AVOID_PROTECTED_HACK = "avoid-protected-hack"_L1;
 static constexpr auto DISABLED_OPTIMIZATIONS = "unoptimize"_L1;
+static constexpr auto JOBS = "jobs"_L1;
 
 struct GeneratorOptions
 {
     bool usePySideExtensions = false;
     bool avoidProtectedHack = false;
     Generator::CodeOptimization optimizations = Generator::AllCodeOptimizations;
+    int jobs = 1;
 };
 
 struct Generator::GeneratorPrivate
@@ -100,7 +108,9 @@ QList<OptionDescription> Generator::options()
          u"Enable PySide extensions, such as support for signal/slots,\n"
           "use this if you are creating a binding for a Qt-based library."_s},
         {DISABLED_OPTIMIZATIONS,
-         "Disable optimization options"_L1}
+         "Disable optimization options"_L1},
+        {u"jobs=<n>"_s,
+         u"Number of threads generating the classes (default: 1)"_s}
     };
 }
 
@@ -150,6 +160,15 @@ bool GeneratorOptionsParser::handleOption(const QString & key, const QString & v
         return true;
     }
 
+    if (key == JOBS) {
+        bool ok{};
+        const int jobs = value.toInt(&ok);
+        if (!ok || jobs < 1)
+            return false;
+        m_options->jobs = jobs;
+        return true;
+    }
+
     return false;
 }
 
@@ -278,6 +297,161 @@ GeneratorContext
     return result;
 }
 
+// Writes the generated files (comparing them against the existing files)
+// on worker threads while the next classes are generated. Used when the
+// classes are generated sequentially. Errors are reported in the order of
+// the files.
+class FileOutWriter
+{
+public:
+    Q_DISABLE_COPY_MOVE(FileOutWriter)
+
+    FileOutWriter() = default;
+    ~FileOutWriter() { m_pool.waitForDone(); }
+
+    void write(std::unique_ptr<FileOut> fileOut);
+    void finish();
+
+private:
+    struct Job
+    {
+        std::unique_ptr<FileOut> fileOut;
+        std::exception_ptr error;
+    };
+
+    QList<std::shared_ptr<Job>> m_jobs;
+    QThreadPool m_pool;
+};
+
+void FileOutWriter::write(std::unique_ptr<FileOut> fileOut)
+{
+    if (FileOut::diff()) { // Do not interleave the printed diffs
+        fileOut->done();
+        return;
+    }
+    auto job = std::make_shared<Job>();
+    job->fileOut = std::move(fileOut);
+    m_jobs.append(job);
+    m_pool.start([job] {
+        try {
+            job->fileOut->done();
+            job->fileOut.reset();
+        } catch (...) {
+            job->error = std::current_exception();
+        }
+    });
+}
+
+// Wait for the files to be written and rethrow the first error.
+void FileOutWriter::finish()
+{
+    m_pool.waitForDone();
+    const auto jobs = std::exchange(m_jobs, {});
+    for (const auto &job : jobs) {
+        if (job->error)
+            std::rethrow_exception(job->error);
+    }
+}
+
+// A class or smart pointer generated on a worker thread.
+struct ClassGenerationJob
+{
+    GeneratorContext context;
+    std::unique_ptr<FileOut> fileOut;
+    ReportHandler::Messages messages;
+    std::exception_ptr error;
+    QSemaphore finished;
+};
+
+void Generator::generateClassesSequentially(const QList<GeneratorContext> &classContexts,
+                                            const QList<GeneratorContext> &smartPointerContexts)
+{
+    const QByteArray timingPrefix = QByteArray(name()) + ": ";
+    FileOutWriter writer;
+    {
+        PhaseTimer timer(timingPrefix + "classes");
+        auto contexts = classContexts;
+        while (!contexts.isEmpty()) {
+            const auto context = contexts.takeFirst();
+            const QString targetDirectory = directoryForContext(context);
+            auto fileOut = std::make_unique<FileOut>(targetDirectory + u'/'
+                                                     + fileNameForContext(context));
+            generateClass(fileOut->stream, targetDirectory, context, &contexts);
+            writer.write(std::move(fileOut));
+        }
+    }
+
+    {
+        PhaseTimer timer(timingPrefix + "smart pointers");
+        for (const auto &context : smartPointerContexts) {
+            const QString targetDirectory = directoryForContext(context);
+            auto fileOut = std::make_unique<FileOut>(targetDirectory + u'/'
+                                                     + fileNameForContext(context));
+            generateSmartPointerClass(fileOut->stream, targetDirectory, context);
+            writer.write(std::move(fileOut));
+        }
+    }
+
+    PhaseTimer timer(timingPrefix + "waiting for files");
+    writer.finish();
+}
+
+// Generates and writes each class on a worker thread. The messages of a
+// class are captured and printed in the order of the classes along with
+// the diffs, so that the output matches the sequential generation.
+void Generator::generateClassesConcurrently(const QList<GeneratorContext> &classContexts,
+                                            const QList<GeneratorContext> &smartPointerContexts)
+{
+    const QByteArray timingPrefix = QByteArray(name()) + ": ";
+    PhaseTimer timer(timingPrefix + "classes and smart pointers");
+
+    QList<std::shared_ptr<ClassGenerationJob>> jobs;
+    jobs.reserve(classContexts.size() + smartPointerContexts.size());
+    QThreadPool pool; // Destroyed (waiting for the jobs) before the jobs
+    pool.setMaxThreadCount(GeneratorPrivate::m_options.jobs);
+
+    const bool diff = FileOut::diff();
+    for (const auto &context : classContexts + smartPointerContexts) {
+        auto job = std::make_shared<ClassGenerationJob>();
+        job->context = context;
+        jobs.append(job);
+        pool.start([this, job, diff] {
+            ReportHandler::startCapture(&job->messages);
+            try {
+                const auto &classContext = job->context;
+                const QString targetDirectory = directoryForContext(classContext);
+                job->fileOut = std::make_unique<FileOut>(targetDirectory + u'/'
+                                                         + fileNameForContext(classContext));
+                if (classContext.forSmartPointer()) {
+                    generateSmartPointerClass(job->fileOut->stream, targetDirectory,
+                                              classContext);
+                } else {
+                    QList<GeneratorContext> contexts; // Not used by ShibokenGenerator
+                    generateClass(job->fileOut->stream, targetDirectory, classContext,
+                                  &contexts);
+                }
+                if (!diff) { // Diffs are printed in order by the main thread
+                    job->fileOut->done();
+                    job->fileOut.reset();
+                }
+            } catch (...) {
+                job->error = std::current_exception();
+            }
+            ReportHandler::endCapture();
+            job->finished.release();
+        });
+    }
+
+    for (const auto &job : std::as_const(jobs)) {
+        job->finished.acquire();
+        ReportHandler::outputMessages(job->messages);
+        if (job->error)
+            std::rethrow_exception(job->error);
+        if (job->fileOut)
+            job->fileOut->done();
+    }
+}
+
 bool Generator::generate()
 {
     QList<GeneratorContext> contexts;
@@ -292,31 +466,32 @@ bool Generator::generate()
         }
     }
 
-    while (!contexts.isEmpty()) {
-        const auto context = contexts.takeFirst();
-        const QString targetDirectory = directoryForContext(context);
-        FileOut fileOut(targetDirectory + u'/' + fileNameForContext(context));
-        generateClass(fileOut.stream, targetDirectory, context, &contexts);
-        fileOut.done();
-    }
-
-    // Generate smart pointers.
+    QList<GeneratorContext> smartPointerContexts;
     for (const auto &smp: m_d->api.instantiatedSmartPointers()) {
         if (shouldGenerate(smp.specialized->typeEntry())) {
             AbstractMetaClassCPtr pointeeClass;
             const auto instantiatedType = smp.type.instantiations().constFirst().typeEntry();
             if (instantiatedType->isComplex()) // not a C++ primitive
                 pointeeClass = AbstractMetaClass::findClass(m_d->api.classes(), instantiatedType);
-            const auto context = contextForSmartPointer(smp.specialized, smp.type, pointeeClass);
-            const QString targetDirectory = directoryForContext(context);
-            FileOut fileOut(targetDirectory + u'/' + fileNameForContext(context));
-            generateSmartPointerClass(fileOut.stream, targetDirectory, context);
-            fileOut.done();
+            smartPointerContexts.append(contextForSmartPointer(smp.specialized, smp.type,
+                                                               pointeeClass));
         }
     }
+
+    if (GeneratorPrivate::m_options.jobs > 1 && supportsConcurrentGeneration())
+        generateClassesConcurrently(contexts, smartPointerContexts);
+    else
+        generateClassesSequentially(contexts, smartPointerContexts);
+
+    PhaseTimer timer(QByteArray(name()) + ": module");
     return finishGeneration();
 }
 
+bool Generator::supportsConcurrentGeneration() const
+{
+    return false;
+}
+
 bool Generator::shouldGenerate(const TypeEntryCPtr &typeEntry) const
 {
     return typeEntry->shouldGenerate();
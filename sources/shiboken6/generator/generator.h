@@ -217,6 +217,10 @@ protected:
                                            const GeneratorContext &classContext);
     virtual bool finishGeneration() = 0;
 
+    /// Returns whether generateClass() and generateSmartPointerClass() may be
+    /// called concurrently for different classes (see the "jobs" option).
+    virtual bool supportsConcurrentGeneration() const;
+
     /**
     *    Returns the subdirectory path for a given package
     *    (aka module, aka library) name.
@@ -235,6 +239,10 @@ protected:
 
 private:
     QString directoryForContext(const GeneratorContext &context) const;
+    void generateClassesSequentially(const QList<GeneratorContext> &classContexts,
+                                     const QList<GeneratorContext> &smartPointerContexts);
+    void generateClassesConcurrently(const QList<GeneratorContext> &classContexts,
+                                     const QList<GeneratorContext> &smartPointerContexts);
 
     struct GeneratorPrivate;
     GeneratorPrivate *m_d;
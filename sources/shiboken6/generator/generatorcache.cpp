@@ -0,0 +1,272 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "generatorcache.h"
+#include "shibokenconfig.h"
+
+#include <messages.h>
+#include <optionsparser.h>
+#include <reporthandler.h>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+
+#include <algorithm>
+
+using namespace Qt::StringLiterals;
+
+// Bump when the format or the semantics of the cache change.
+static const char cacheHeader[] = "shiboken-generator-cache 1";
+
+GeneratorCache::GeneratorCache(QString fileName) : m_fileName(std::move(fileName))
+{
+}
+
+QByteArray GeneratorCache::optionsHash(const Options &options)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray(cacheHeader));
+    hash.addData(QByteArray(SHIBOKEN_VERSION));
+    // A rebuilt generator may produce different code for the same version.
+    const QFileInfo generator(QCoreApplication::applicationFilePath());
+    hash.addData((generator.absoluteFilePath() + u' ' + QString::number(generator.size())
+                  + u' ' + QString::number(generator.lastModified().toMSecsSinceEpoch())).toUtf8());
+    hash.addData(QDir::currentPath().toUtf8());
+    hash.addData(qgetenv("TYPESYSTEMPATH"));
+    for (const auto &o : options.boolOptions)
+        hash.addData((u'\n' + o.option).toUtf8());
+    for (const auto &o : options.valueOptions)
+        hash.addData((u'\n' + o.option + u'=' + o.value).toUtf8());
+    for (const auto &p : options.positionalArguments)
+        hash.addData((u'\n' + p).toUtf8());
+    return hash.result().toHex();
+}
+
+static QByteArray fileHash(QFile &file)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(&file);
+    return hash.result().toHex();
+}
+
+GeneratorCache::Entry GeneratorCache::entryForFile(const QString &filePath,
+                                                   const QByteArray &hash) const
+{
+    const QFileInfo fi(filePath);
+    Entry result{fi.absoluteFilePath(), hash, fi.size(),
+                 fi.lastModified().toMSecsSinceEpoch()};
+    if (result.hash.isEmpty()) {
+        const auto previous = m_previousInputs.constFind(result.filePath);
+        if (previous != m_previousInputs.cend() && previous->size == result.size
+            && previous->lastModified == result.lastModified) {
+            result.hash = previous->hash;
+        } else {
+            QFile file(filePath);
+            if (file.open(QIODevice::ReadOnly))
+                result.hash = fileHash(file);
+        }
+    }
+    return result;
+}
+
+static QString msgCannotWriteCache(const QSaveFile &file)
+{
+    return u"Cannot write generator cache "_s + QDir::toNativeSeparators(file.fileName())
+        + u": "_s + file.errorString();
+}
+
+// Parse "<size> <mtime> <hash> <path>", the path may contain spaces.
+static bool parseEntry(const QByteArray &value, qint64 *size, qint64 *lastModified,
+                       QByteArray *hash, QString *filePath)
+{
+    const auto sizeEnd = value.indexOf(' ');
+    const auto timeEnd = sizeEnd != -1 ? value.indexOf(' ', sizeEnd + 1) : -1;
+    const auto hashEnd = timeEnd != -1 ? value.indexOf(' ', timeEnd + 1) : -1;
+    if (hashEnd == -1)
+        return false;
+    bool sizeOk{};
+    bool timeOk{};
+    *size = value.left(sizeEnd).toLongLong(&sizeOk);
+    *lastModified = value.mid(sizeEnd + 1, timeEnd - sizeEnd - 1).toLongLong(&timeOk);
+    *hash = value.mid(timeEnd + 1, hashEnd - timeEnd - 1);
+    *filePath = QString::fromUtf8(value.mid(hashEnd + 1));
+    return sizeOk && timeOk && !filePath->isEmpty();
+}
+
+bool GeneratorCache::read()
+{
+    QFile file(m_fileName);
+    if (!file.exists()) {
+        m_missReason = u"no cache file"_s;
+        return false;
+    }
+    if (!file.open(QIODevice::ReadOnly)) {
+        m_missReason = msgCannotOpenForReading(file);
+        return false;
+    }
+    const QByteArrayList lines = file.readAll().split('\n');
+    if (lines.constFirst() != cacheHeader) {
+        m_missReason = u"incompatible cache file"_s;
+        return false;
+    }
+
+    for (qsizetype i = 1, size = lines.size(); i < size; ++i) {
+        const QByteArray &line = lines.at(i);
+        const auto space = line.indexOf(' ');
+        if (space == -1)
+            continue;
+        const QByteArray key = line.left(space);
+        const QByteArray value = line.mid(space + 1);
+        if (key == "options") {
+            m_optionsHash = value;
+        } else if (key == "hits") {
+            m_hits = value.toLongLong();
+        } else if (key == "misses") {
+            m_misses = value.toLongLong();
+        } else if (key == "input" || key == "output") {
+            Entry entry;
+            if (!parseEntry(value, &entry.size, &entry.lastModified,
+                            &entry.hash, &entry.filePath)) {
+                m_missReason = u"invalid cache file"_s;
+                return false;
+            }
+            if (key == "input") {
+                m_previousInputs.insert(entry.filePath, entry);
+                m_inputs.append(entry);
+            } else {
+                m_outputs.append(entry);
+            }
+        }
+    }
+    return true;
+}
+
+// Check a recorded file, rehashing it when its size or time stamp changed.
+bool GeneratorCache::checkEntry(Entry *entry)
+{
+    const QFileInfo fi(entry->filePath);
+    if (!fi.isFile()) {
+        m_missReason = QDir::toNativeSeparators(entry->filePath) + u" was removed"_s;
+        return false;
+    }
+    const qint64 lastModified = fi.lastModified().toMSecsSinceEpoch();
+    if (fi.size() == entry->size && lastModified == entry->lastModified)
+        return true;
+    QFile file(entry->filePath);
+    if (!file.open(QIODevice::ReadOnly) || fileHash(file) != entry->hash) {
+        m_missReason = QDir::toNativeSeparators(entry->filePath) + u" changed"_s;
+        return false;
+    }
+    entry->size = fi.size(); // Touched only
+    entry->lastModified = lastModified;
+    return true;
+}
+
+bool GeneratorCache::isUpToDate(const QByteArray &optionsHash)
+{
+    m_hit = read();
+    if (m_hit && m_optionsHash != optionsHash) {
+        m_missReason = u"options changed"_s;
+        m_hit = false;
+    }
+    if (m_hit && m_outputs.isEmpty()) {
+        m_missReason = u"no generated files"_s;
+        m_hit = false;
+    }
+    for (auto it = m_inputs.begin(), end = m_inputs.end(); m_hit && it != end; ++it)
+        m_hit = checkEntry(&(*it));
+    for (auto it = m_outputs.begin(), end = m_outputs.end(); m_hit && it != end; ++it)
+        m_hit = checkEntry(&(*it));
+
+    if (!m_hit) {
+        ++m_misses;
+        return false;
+    }
+
+    ++m_hits;
+    QString errorMessage; // Update the statistics and time stamps
+    if (!write(m_optionsHash, {}, {}, &errorMessage))
+        qCWarning(lcShiboken, "%s", qPrintable(errorMessage));
+    return true;
+}
+
+// Write the cache file. When called for a hit, the recorded entries are
+// kept.
+bool GeneratorCache::write(const QByteArray &optionsHash, const QStringList &inputFiles,
+                           const FileOut::Records &outputs, QString *errorMessage)
+{
+    if (!m_hit) {
+        QStringList inputPaths;
+        inputPaths.reserve(inputFiles.size());
+        for (const auto &inputFile : inputFiles)
+            inputPaths.append(QFileInfo(inputFile).absoluteFilePath());
+        std::sort(inputPaths.begin(), inputPaths.end());
+        inputPaths.erase(std::unique(inputPaths.begin(), inputPaths.end()), inputPaths.end());
+
+        m_inputs.clear();
+        m_inputs.reserve(inputPaths.size());
+        for (const auto &inputPath : std::as_const(inputPaths))
+            m_inputs.append(entryForFile(inputPath));
+
+        // Files are written concurrently, sort them for a stable cache file.
+        auto sortedOutputs = outputs;
+        std::sort(sortedOutputs.begin(), sortedOutputs.end(),
+                  [](const FileOut::Record &r1, const FileOut::Record &r2) {
+                      return r1.filePath < r2.filePath;
+                  });
+        m_outputs.clear();
+        m_outputs.reserve(sortedOutputs.size());
+        m_written = 0;
+        for (const auto &record : std::as_const(sortedOutputs)) {
+            m_outputs.append(entryForFile(record.filePath, record.hash.toHex()));
+            if (record.state == FileOut::Success)
+                ++m_written;
+        }
+    }
+
+    QSaveFile file(m_fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        *errorMessage = msgCannotWriteCache(file);
+        return false;
+    }
+    QByteArray data = cacheHeader + "\noptions "_ba + optionsHash
+        + "\nhits "_ba + QByteArray::number(m_hits)
+        + "\nmisses "_ba + QByteArray::number(m_misses) + '\n';
+    auto writeEntries = [&data](const char *key, const Entries &entries) {
+        for (const auto &entry : entries) {
+            data += key;
+            data += ' ' + QByteArray::number(entry.size)
+                + ' ' + QByteArray::number(entry.lastModified)
+                + ' ' + entry.hash + ' ' + entry.filePath.toUtf8() + '\n';
+        }
+    };
+    writeEntries("input", m_inputs);
+    writeEntries("output", m_outputs);
+    if (file.write(data) == -1 || !file.commit()) {
+        *errorMessage = msgCannotWriteCache(file);
+        return false;
+    }
+    return true;
+}
+
+QByteArray GeneratorCache::statisticsMessage() const
+{
+    QByteArray result = "Generator cache ";
+    if (m_hit) {
+        result += "hit: " + QByteArray::number(m_inputs.size()) + " input files, "
+            + QByteArray::number(m_outputs.size()) + " generated files unchanged";
+    } else {
+        result += "miss (" + m_missReason.toUtf8() + "): "
+            + QByteArray::number(m_written) + " of "
+            + QByteArray::number(m_outputs.size()) + " generated files written";
+    }
+    result += " (" + QByteArray::number(m_hits) + " hits, "
+        + QByteArray::number(m_misses) + " misses)\n";
+    return result;
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef GENERATORCACHE_H
+#define GENERATORCACHE_H
+
+#include <fileout.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+struct Options;
+
+// On-disk record of a shiboken run (--cache-file). It stores a hash of the
+// options and the generator binary and the content hashes (SHA-1) of the
+// inputs (type system files, snippet files, headers included by the parsed
+// translation unit or by its precompiled header) and of the generated
+// files. When none of them changed, the next run skips parsing and
+// generation. Files whose size and modification time match the record are
+// not hashed again.
+class GeneratorCache
+{
+public:
+    Q_DISABLE_COPY_MOVE(GeneratorCache)
+
+    explicit GeneratorCache(QString fileName);
+
+    static QByteArray optionsHash(const Options &options);
+
+    /// Reads the cache file and checks whether all recorded files are
+    /// unchanged. Updates the hit/miss statistics.
+    bool isUpToDate(const QByteArray &optionsHash);
+
+    /// Writes the cache file after a successful run.
+    bool write(const QByteArray &optionsHash, const QStringList &inputFiles,
+               const FileOut::Records &outputs, QString *errorMessage);
+
+    QByteArray statisticsMessage() const;
+
+private:
+    struct Entry
+    {
+        QString filePath;
+        QByteArray hash; // SHA-1 as hex
+        qint64 size = -1;
+        qint64 lastModified = -1; // msecs since epoch
+    };
+    using Entries = QList<Entry>;
+
+    bool read();
+    bool checkEntry(Entry *entry);
+    Entry entryForFile(const QString &filePath, const QByteArray &hash = {}) const;
+
+    QString m_fileName;
+    QByteArray m_optionsHash;
+    Entries m_inputs;
+    Entries m_outputs;
+    QHash<QString, Entry> m_previousInputs; // To avoid rehashing
+    QString m_missReason;
+    qsizetype m_hits = 0;
+    qsizetype m_misses = 0;
+    qsizetype m_written = 0;
+    bool m_hit = false;
+};
+
+#endif // GENERATORCACHE_H
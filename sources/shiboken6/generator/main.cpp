@@ -4,6 +4,7 @@
 #include "shibokenconfig.h"
 #include "cppgenerator.h"
 #include "generator.h"
+#include "generatorcache.h"
 #include "headergenerator.h"
 #include "qtdocgenerator.h"
 
@@ -49,8 +50,10 @@ static inline Generators shibokenGenerators()
 
 struct CommonOptions
 {
+    QString cacheFile;
     QString generatorSet;
     QString licenseComment;
+    QString licenseFileName;
     QString outputDirectory = u"out"_s;
     QStringList headers;
     QString typeSystemFileName;
@@ -79,6 +82,8 @@ private:
 OptionDescriptions CommonOptionsParser::optionDescriptions()
 {
     return {
+        {u"cache-file=<file>"_s,
+         u"Skip parsing and generation if the inputs recorded in the file are unchanged"_s},
         {u"debug-level=[sparse|medium|full]"_s,
          u"Set the debug level"_s},
         {u"documentation-only"_s,
@@ -108,6 +113,8 @@ OptionDescriptions CommonOptionsParser::optionDescriptions()
          u"text file containing a description of the binding project.\n"
           "Replaces and overrides command line arguments"_s},
         {u"silent"_s, u"Avoid printing any message"_s},
+        {u"timings"_s,
+         u"Print the wall-clock and CPU times of the generation phases"_s},
         {u"print-builtin-types"_s,
          u"Print information about builtin types"_s},
         {u"version"_s,
@@ -145,6 +152,10 @@ bool CommonOptionsParser::handleBoolOption(const QString &key, OptionSource sour
         ReportHandler::setSilent(true);
         return true;
     }
+    if (key == u"timings") {
+        ReportHandler::setTimingsEnabled(true);
+        return true;
+    }
     if (key == u"log-unmatched") {
         m_options->logUnmatched = true;
         return true;
@@ -167,11 +178,16 @@ bool CommonOptionsParser::handleOption(const QString &key, const QString &value,
         m_options->generatorSet = value;
         return true;
     }
+    if (key == u"cache-file") {
+        m_options->cacheFile = value;
+        return true;
+    }
     if (key == u"license-file") {
         QFile licenseFile(value);
         if (!licenseFile.open(QIODevice::ReadOnly))
             throw Exception(msgCannotOpenForReading(licenseFile));
         m_options->licenseComment = QString::fromUtf8(licenseFile.readAll());
+        m_options->licenseFileName = value;
         return true;
     }
     if (key == u"debug-level") {
@@ -257,6 +273,7 @@ int shibokenMain(const QStringList &argV)
 
     Options options;
     options.setOptions(argV);
+    const QByteArray optionsHash = GeneratorCache::optionsHash(options);
 
     CommonOptions commonOptions;
     {
@@ -355,12 +372,34 @@ int shibokenMain(const QStringList &argV)
     extractor.setCppFileNames(cppFileNames);
     extractor.setTypeSystem(commonOptions.typeSystemFileName);
 
+    // The cache does not track the inputs of the documentation generator
+    // and would suppress the output of some options.
+    std::optional<GeneratorCache> cache;
+    if (!commonOptions.cacheFile.isEmpty()) {
+        if (commonOptions.generatorSet == u"qtdoc" || FileOut::diff() || FileOut::dryRun()
+            || commonOptions.logUnmatched || commonOptions.printBuiltinTypes) {
+            qCWarning(lcShiboken, "The generator cache is not used with the given options.");
+        } else {
+            cache.emplace(commonOptions.cacheFile);
+        }
+    }
+    if (cache.has_value() && cache->isUpToDate(optionsHash)) {
+        if (!ReportHandler::isSilent())
+            std::cout << cache->statisticsMessage().constData();
+        return EXIT_SUCCESS;
+    }
+    FileOut::setRecording(cache.has_value());
+
     ApiExtractorFlags apiExtractorFlags;
     if (generators.constFirst()->usePySideExtensions())
         apiExtractorFlags.setFlag(ApiExtractorFlag::UsePySideExtensions);
     if (generators.constFirst()->avoidProtectedHack())
         apiExtractorFlags.setFlag(ApiExtractorFlag::AvoidProtectedHack);
-    const std::optional<ApiExtractorResult> apiOpt = extractor.run(apiExtractorFlags);
+    std::optional<ApiExtractorResult> apiOpt;
+    {
+        PhaseTimer timer("ApiExtractor");
+        apiOpt = extractor.run(apiExtractorFlags);
+    }
 
     if (!apiOpt.has_value()) {
         errorPrint(u"Error running ApiExtractor."_s, argV);
@@ -395,8 +434,22 @@ int shibokenMain(const QStringList &argV)
     if (commonOptions.logUnmatched)
         TypeDatabase::instance()->logUnmatched();
 
+    if (cache.has_value()) {
+        QString errorMessage;
+        QStringList inputFiles = TypeDatabase::instance()->inputFiles()
+                                 + extractor.includedFiles();
+        if (!commonOptions.licenseFileName.isEmpty())
+            inputFiles.append(commonOptions.licenseFileName);
+        if (!cache->write(optionsHash, inputFiles, FileOut::records(), &errorMessage))
+            qCWarning(lcShiboken, "%s", qPrintable(errorMessage));
+    }
+
     const QByteArray doneMessage = ReportHandler::doneMessage();
     std::cout << doneMessage.constData() << '\n';
+    if (ReportHandler::timingsEnabled())
+        std::cout << ReportHandler::timingsMessage().constData();
+    if (cache.has_value() && !ReportHandler::isSilent())
+        std::cout << cache->statisticsMessage().constData();
 
     return EXIT_SUCCESS;
 }
@@ -53,6 +53,7 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <numeric>
 #include <set>
 
 using namespace Qt::StringLiterals;
@@ -300,16 +301,29 @@ QString CppGenerator::fileNameForContext(const GeneratorContext &context) const
     return fileNameForContextHelper(context, u"_wrapper.cpp"_s);
 }
 
-void CppGenerator::clearTpFuncs()
+// Functions that should not be registered under a name in PyMethodDef,
+// but under a special constant under slots, mapped to the name of the
+// generated function.
+using SlotFunctions = QHash<QString, QString>;
+
+static SlotFunctions tpFunctions()
 {
-    // Functions that should not be registered under a name in PyMethodDef,
-    // but under a special constant under slots.
-    m_tpFuncs = {
-        {u"__str__"_s, {}}, {u"__str__"_s, {}},
-        {REPR_FUNCTION, {}}, {u"__iter__"_s, {}},
-        {u"__next__"_s, {}}
+    return {
+        {u"__str__"_s, {}}, {REPR_FUNCTION, {}},
+        {u"__iter__"_s, {}}, {u"__next__"_s, {}}
     };
-    m_nbFuncs = { {u"__abs__"_s, {}}, {u"__pow__"_s, {} }};
+}
+
+static SlotFunctions nbFunctions()
+{
+    return { {u"__abs__"_s, {}}, {u"__pow__"_s, {} }};
+}
+
+static bool isSlotFunction(const QString &name)
+{
+    static const SlotFunctions tpFuncs = tpFunctions();
+    static const SlotFunctions nbFuncs = nbFunctions();
+    return tpFuncs.contains(name) || nbFuncs.contains(name);
 }
 
 // Prevent ELF symbol qt_version_tag from being generated into the source
@@ -319,19 +333,24 @@ static const char includeQDebug[] =
 "#endif\n"
 "#include <QtCore/QDebug>\n";
 
+static QString createCompilerOptionOptimize()
+{
+    QString result;
+    const auto optimizations = CppGenerator::optimizations();
+    QTextStream str(&result);
+    str << "#define PYSIDE6_COMOPT_FULLNAME "
+        << (optimizations.testFlag(Generator::RemoveFullnameField) ? '1' : '0')
+        << "\n#define PYSIDE6_COMOPT_COMPRESS "
+        << (optimizations.testFlag(Generator::CompressSignatureStrings) ? '1' : '0')
+        << "\n// TODO: #define PYSIDE6_COMOPT_FOLDING "
+        << (optimizations.testFlag(Generator::FoldCommonTailCode) ? '1' : '0') << '\n';
+    str.flush();
+    return result;
+}
+
 static QString compilerOptionOptimize()
 {
-    static QString result;
-    if (result.isEmpty()) {
-        const auto optimizations = CppGenerator::optimizations();
-        QTextStream str(&result);
-        str << "#define PYSIDE6_COMOPT_FULLNAME "
-            << (optimizations.testFlag(Generator::RemoveFullnameField) ? '1' : '0')
-            << "\n#define PYSIDE6_COMOPT_COMPRESS "
-            << (optimizations.testFlag(Generator::CompressSignatureStrings) ? '1' : '0')
-            << "\n// TODO: #define PYSIDE6_COMOPT_FOLDING "
-            << (optimizations.testFlag(Generator::FoldCommonTailCode) ? '1' : '0') << '\n';
-    }
+    static const QString result = createCompilerOptionOptimize();
     return result;
 }
 
@@ -749,8 +768,7 @@ void CppGenerator::generateClass(TextStream &s,
                 smd << "static PyMethodDef " << methDefName << " = " << indent
                     << defEntries.constFirst() << outdent << ";\n\n";
             }
-            const auto &fname = rfunc->name();
-            if (!m_tpFuncs.contains(fname) && !m_nbFuncs.contains(fname))
+            if (!isSlotFunction(rfunc->name()))
                 md << defEntries;
         }
     }
@@ -2066,6 +2084,24 @@ static bool canAvoidFullname(const GeneratorContext &context)
            && context.hasClass();
 }
 
+// Whether a function taking a list of arguments is written using
+// METH_FASTCALL (vectorcall) instead of METH_VARARGS. Code injections
+// may expect the arguments tuple, so those functions are excluded.
+static bool usesFastCall(const OverloadData &overloadData)
+{
+    if (!ShibokenGenerator::useFastCall()
+        || !overloadData.pythonFunctionWrapperUsesListOfArguments()
+        || overloadData.hasVarargs()) {
+        return false;
+    }
+    const auto rfunc = overloadData.referenceFunction();
+    if (rfunc->isConstructor() || rfunc->isCallOperator() || rfunc->isOperatorOverload())
+        return false;
+    const auto &overloads = overloadData.overloads();
+    return std::none_of(overloads.cbegin(), overloads.cend(),
+                        [](const AbstractMetaFunctionCPtr &f) { return f->hasInjectedCode(); });
+}
+
 void CppGenerator::writeMethodWrapperPreamble(TextStream &s,
                                               const OverloadData &overloadData,
                                               const GeneratorContext &context,
@@ -2307,7 +2343,13 @@ void CppGenerator::writeMethodWrapper(TextStream &s, const OverloadData &overloa
     s << "static PyObject *";
     s << cpythonFunctionName(rfunc) << "(PyObject *self";
     bool hasKwdArgs = false;
-    if (maxArgs > 0) {
+    const bool fastCall = usesFastCall(overloadData);
+    if (fastCall) {
+        s << ", PyObject *const *args, Py_ssize_t nargs";
+        hasKwdArgs = overloadData.hasArgumentWithDefaultValue();
+        if (hasKwdArgs)
+            s << ", PyObject *kwnames";
+    } else if (maxArgs > 0) {
         s << ", PyObject *"
             << (overloadData.pythonFunctionWrapperUsesListOfArguments() ? u"args"_s : PYTHON_ARG);
         hasKwdArgs = overloadData.hasArgumentWithDefaultValue() || rfunc->isCallOperator();
@@ -2317,7 +2359,7 @@ void CppGenerator::writeMethodWrapper(TextStream &s, const OverloadData &overloa
     s << ")\n{\n" << indent;
     if (rfunc->ownerClass() == nullptr || overloadData.hasStaticFunction())
         s << sbkUnusedVariableCast(PYTHON_SELF_VAR);
-    if (hasKwdArgs)
+    if (hasKwdArgs && !fastCall)
         s << sbkUnusedVariableCast("kwds");
 
     writeMethodWrapperPreamble(s, overloadData, classContext);
@@ -2390,7 +2432,8 @@ void CppGenerator::writeArgumentsInitializer(TextStream &s, const OverloadData &
                                              ErrorReturn errorReturn)
 {
     const auto rfunc = overloadData.referenceFunction();
-    s << "PyTuple_Size(args);\n" << sbkUnusedVariableCast("numArgs");
+    const bool fastCall = usesFastCall(overloadData);
+    s << (fastCall ? "nargs;\n" : "PyTuple_Size(args);\n") << sbkUnusedVariableCast("numArgs");
 
     int minArgs = overloadData.minArgs();
     int maxArgs = overloadData.maxArgs();
@@ -2400,6 +2443,15 @@ void CppGenerator::writeArgumentsInitializer(TextStream &s, const OverloadData &
         << QByteArrayList(maxArgs, "nullptr").join(", ")
         << "};\n\n";
 
+    bool usesNamedArguments = overloadData.hasArgumentWithDefaultValue();
+
+    if (fastCall && usesNamedArguments) {
+        s << "Shiboken::AutoDecRef kwdsHolder(Shiboken::fastCallKeywordsToDict(args + nargs, kwnames));\n"
+            << "if (kwdsHolder.isNull() && PyErr_Occurred() != nullptr)\n"
+            << indent << errorReturn << outdent
+            << "PyObject *kwds = kwdsHolder.object();\n\n";
+    }
+
     if (overloadData.hasVarargs()) {
         maxArgs--;
         if (minArgs > maxArgs)
@@ -2413,8 +2465,6 @@ void CppGenerator::writeArgumentsInitializer(TextStream &s, const OverloadData &
             << maxArgs << "]);\n\n";
     }
 
-    bool usesNamedArguments = overloadData.hasArgumentWithDefaultValue();
-
     s << "// invalid argument lengths\n";
 
     // Disable argument count checks for QObject constructors to allow for
@@ -2451,6 +2501,13 @@ void CppGenerator::writeArgumentsInitializer(TextStream &s, const OverloadData &
     else
         funcName = rfunc->name();
 
+    if (fastCall) {
+        s << "if (!Shiboken::unpackFastCallArguments(args, nargs, \"" << funcName << "\", "
+            << (usesNamedArguments ? 0 : minArgs) << ", " << maxArgs << ", "
+            << PYTHON_ARGS << "))\n" << indent << errorReturn << outdent << '\n';
+        return;
+    }
+
     QString argsVar = overloadData.hasVarargs() ?  u"nonvarargs"_s : u"args"_s;
     s << "if (";
     if (usesNamedArguments) {
@@ -2574,6 +2631,8 @@ QString CppGenerator::returnErrorWrongArguments(const OverloadData &overloadData
     }
     QString argsVar = overloadData.pythonFunctionWrapperUsesListOfArguments()
         ? u"args"_s : PYTHON_ARG;
+    if (usesFastCall(overloadData))
+        argsVar = u"Shiboken::AutoDecRef(Shiboken::fastCallArgumentsToTuple(args, nargs))"_s;
     switch (errorReturn) {
     case ErrorReturn::Default:
     case ErrorReturn::NullPtr:
@@ -2990,7 +3049,20 @@ void CppGenerator::writeOverloadedFunctionDecisor(TextStream &s,
             s << decl->name() << "::";
         s << func->signatureComment() << '\n';
     }
+    const bool useCache = usesOverloadCache(overloadData);
+    if (useCache) {
+        s << "static Shiboken::OverloadCache overloadCache;\n"
+            << "unsigned overloadCacheGeneration{};\n"
+            << "if (!overloadCache.lookup(" << PYTHON_ARGS << ", numArgs, &overloadId, "
+            << PYTHON_TO_CPP_VAR << ", " << overloadData.maxArgs()
+            << ", &overloadCacheGeneration)) {\n" << indent;
+    }
     writeOverloadedFunctionDecisorEngine(s, overloadData, &overloadData);
+    if (useCache) {
+        s << "overloadCache.store(" << PYTHON_ARGS << ", numArgs, overloadId, "
+            << PYTHON_TO_CPP_VAR << ", " << overloadData.maxArgs()
+            << ", overloadCacheGeneration);\n" << outdent << "}\n";
+    }
     s << '\n';
 
     // Ensure that the direct overload that called this reverse
@@ -3008,6 +3080,83 @@ void CppGenerator::writeOverloadedFunctionDecisor(TextStream &s,
             << ";\n\n" << outdent;
 }
 
+// Whether the overload decisor of a function uses the type-keyed inline
+// cache (Shiboken::OverloadCache). This requires the list of arguments and
+// type checks whose results depend on the argument types only.
+bool CppGenerator::usesOverloadCache(const OverloadData &overloadData) const
+{
+    static constexpr int maxCachedArguments = 8; // Shiboken::OverloadCache::MaxArguments
+
+    if (!useOverloadCache() || overloadData.overloads().size() < 2
+        || !overloadData.pythonFunctionWrapperUsesListOfArguments()
+        || overloadData.hasVarargs() || overloadData.maxArgs() > maxCachedArguments) {
+        return false;
+    }
+    // Reverse operators depend on the "isReverse" flag
+    if (overloadData.referenceFunction()->isOperatorOverload())
+        return false;
+    return hasTypeDeterminedChecks(&overloadData);
+}
+
+bool CppGenerator::hasTypeDeterminedChecks(const OverloadDataRootNode *node) const
+{
+    for (const auto &child : node->children()) {
+        if (child->argType().isVarargs())
+            return false;
+        const bool typeReplacedByPyObject = child->isTypeModified()
+            && child->modifiedArgType().name() == cPyObjectT;
+        if (!typeReplacedByPyObject) {
+            AbstractMetaType argType = child->modifiedArgType();
+            if (const auto *viewOn = argType.viewOn())
+                argType = *viewOn;
+            if (!isTypeDeterminedCheck(argType))
+                return false;
+        }
+        if (!hasTypeDeterminedChecks(child.get()))
+            return false;
+    }
+    return true;
+}
+
+// Check whether the type check written by writeTypeCheck() only depends on
+// the Python type of the argument. This excludes containers (which check
+// their elements), characters (strings of length 1) and custom checks.
+// For value types, the sources of their implicit conversions are checked.
+bool CppGenerator::isTypeDeterminedCheck(const AbstractMetaType &type, int depth) const
+{
+    const auto typeEntry = type.typeEntry();
+    if (typeEntry->isCustom() || typeEntry->isVarargs() || type.isContainer()
+        || type.isArray() || type.isSmartPointer() || type.generateOpaqueContainer()
+        || type.typeUsagePattern() == AbstractMetaType::NativePointerAsArrayPattern) {
+        return false;
+    }
+    if (type.isCString() || type.isEnum() || type.isFlags())
+        return true;
+    if (type.isCppPrimitive())
+        return !typeEntry->name().contains(u"char"_s);
+    if (!type.isWrapperType())
+        return false;
+    if (type.isPointer() || type.isValueTypeWithCopyConstructorOnly() || !typeEntry->isValue())
+        return true;
+
+    const auto vte = std::static_pointer_cast<const ValueTypeEntry>(typeEntry);
+    const auto customConversion = vte->customConversion();
+    if (customConversion && !customConversion->targetToNativeConversions().isEmpty())
+        return false;
+    const auto conversions = implicitConversions(typeEntry);
+    if (!conversions.isEmpty() && depth > 0)
+        return false;
+    for (const auto &conversion : conversions) {
+        if (conversion->isConversionOperator()) // From a wrapper type
+            continue;
+        if (conversion->arguments().isEmpty()
+            || !isTypeDeterminedCheck(conversion->arguments().constFirst().type(), depth + 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void CppGenerator::writeOverloadedFunctionDecisorEngine(TextStream &s,
                                                         const OverloadData &overloadData,
                                                         const OverloadDataRootNode *node) const
@@ -4162,19 +4311,22 @@ void CppGenerator::writeMethodCall(TextStream &s, const AbstractMetaFunctionCPtr
             const QString pyArgName = refCount.action == ReferenceCount::Remove
                 ? u"Py_None"_s : argumentNameFromIndex(api(), func, argIndex);
 
+            QString varName = arg_mod.referenceCounts().constFirst().varName;
+            if (varName.isEmpty())
+                varName = func->minimalSignature() + QString::number(argIndex);
+
+            // Intern the key once
+            s << "{\n" << indent
+                << "static const auto referenceKey = Shiboken::Object::referenceKey(\""
+                << varName << "\");\n";
             if (refCount.action == ReferenceCount::Add || refCount.action == ReferenceCount::Set)
                 s << "Shiboken::Object::keepReference(";
             else
                 s << "Shiboken::Object::removeReference(";
 
-            s << "reinterpret_cast<SbkObject *>(self), \"";
-            QString varName = arg_mod.referenceCounts().constFirst().varName;
-            if (varName.isEmpty())
-                varName = func->minimalSignature() + QString::number(argIndex);
-
-            s << varName << "\", " << pyArgName
+            s << "reinterpret_cast<SbkObject *>(self), referenceKey, " << pyArgName
               << (refCount.action == ReferenceCount::Add ? ", true" : "")
-              << ");\n";
+              << ");\n" << outdent << "}\n";
 
             if (argIndex == 0)
                 hasReturnPolicy = true;
@@ -4479,7 +4631,7 @@ TextStream &operator<<(TextStream &str, const pyTypeSlotEntry &e)
 
 void CppGenerator::writeClassDefinition(TextStream &s,
                                         const AbstractMetaClassCPtr &metaClass,
-                                        const GeneratorContext &classContext)
+                                        const GeneratorContext &classContext) const
 {
     QString tp_init;
     QString tp_new;
@@ -4557,21 +4709,22 @@ void CppGenerator::writeClassDefinition(TextStream &s,
         tp_getset = cpythonGettersSettersDefinitionName(metaClass);
 
     // search for special functions
-    clearTpFuncs();
+    SlotFunctions tpFuncs = tpFunctions();
+    SlotFunctions nbFuncs = nbFunctions();
     for (const auto &func : metaClass->functions()) {
         // Special non-operator functions identified by name
-        auto it = m_tpFuncs.find(func->name());
-        if (it != m_tpFuncs.end())
+        auto it = tpFuncs.find(func->name());
+        if (it != tpFuncs.end())
             it.value() = cpythonFunctionName(func);
-        else if ( it = m_nbFuncs.find(func->name()); it !=  m_nbFuncs.end() )
+        else if ( it = nbFuncs.find(func->name()); it !=  nbFuncs.end() )
             it.value() = cpythonFunctionName(func);
     }
-    if (m_tpFuncs.value(REPR_FUNCTION).isEmpty()
+    if (tpFuncs.value(REPR_FUNCTION).isEmpty()
         && (isSmartPointer || metaClass->hasToStringCapability())) {
         const QString name = isSmartPointer
           ? writeSmartPointerReprFunction(s, classContext)
           : writeReprFunction(s, classContext, metaClass->toStringCapabilityIndirections());
-        m_tpFuncs[REPR_FUNCTION] = name;
+        tpFuncs[REPR_FUNCTION] = name;
     }
 
     // class or some ancestor has multiple inheritance
@@ -4601,17 +4754,17 @@ void CppGenerator::writeClassDefinition(TextStream &s,
         << "}\n\nstatic PyType_Slot " << className << "_slots[] = {\n" << indent
         << "{Py_tp_base,        nullptr}, // inserted by introduceWrapperType\n"
         << pyTypeSlotEntry("Py_tp_dealloc", tp_dealloc)
-      << pyTypeSlotEntry("Py_tp_repr", m_tpFuncs.value(REPR_FUNCTION))
+      << pyTypeSlotEntry("Py_tp_repr", tpFuncs.value(REPR_FUNCTION))
         << pyTypeSlotEntry("Py_tp_hash", tp_hash)
         << pyTypeSlotEntry("Py_tp_call", tp_call)
-        << pyTypeSlotEntry("Py_tp_str", m_tpFuncs.value(u"__str__"_s))
+        << pyTypeSlotEntry("Py_tp_str", tpFuncs.value(u"__str__"_s))
         << pyTypeSlotEntry("Py_tp_getattro", tp_getattro)
         << pyTypeSlotEntry("Py_tp_setattro", tp_setattro)
         << pyTypeSlotEntry("Py_tp_traverse", className + u"_traverse"_s)
         << pyTypeSlotEntry("Py_tp_clear", className + u"_clear"_s)
         << pyTypeSlotEntry("Py_tp_richcompare", tp_richcompare)
-        << pyTypeSlotEntry("Py_tp_iter", m_tpFuncs.value(u"__iter__"_s))
-        << pyTypeSlotEntry("Py_tp_iternext", m_tpFuncs.value(u"__next__"_s))
+        << pyTypeSlotEntry("Py_tp_iter", tpFuncs.value(u"__iter__"_s))
+        << pyTypeSlotEntry("Py_tp_iternext", tpFuncs.value(u"__next__"_s))
         << pyTypeSlotEntry("Py_tp_methods", className + u"_methods"_s)
         << pyTypeSlotEntry("Py_tp_getset", tp_getset)
         << pyTypeSlotEntry("Py_tp_init", tp_init)
@@ -4626,7 +4779,7 @@ void CppGenerator::writeClassDefinition(TextStream &s,
     }
     if (supportsNumberProtocol(metaClass)) {
         s << "// type supports number protocol\n";
-        writeTypeAsNumberDefinition(s, metaClass);
+        writeTypeAsNumberDefinition(s, metaClass, nbFuncs);
     }
     s << "{0, " << NULL_PTR << "}\n" << outdent << "};\n";
 
@@ -4794,7 +4947,9 @@ static const QHash<QString, QString> &nbFuncs()
     return result;
 }
 
-void CppGenerator::writeTypeAsNumberDefinition(TextStream &s, const AbstractMetaClassCPtr &metaClass) const
+void CppGenerator::writeTypeAsNumberDefinition(TextStream &s,
+                                               const AbstractMetaClassCPtr &metaClass,
+                                               const QHash<QString, QString> &nbSlotFunctions) const
 {
     QMap<QString, QString> nb;
 
@@ -4805,7 +4960,7 @@ void CppGenerator::writeTypeAsNumberDefinition(TextStream &s, const AbstractMeta
         nb[opName] = cpythonFunctionName(rfunc);
     }
 
-    for (auto it = m_nbFuncs.cbegin(), end = m_nbFuncs.cend(); it != end; ++it) {
+    for (auto it = nbSlotFunctions.cbegin(), end = nbSlotFunctions.cend(); it != end; ++it) {
         if (!it.value().isEmpty())
             nb.insert(it.key(), it.value());
     }
@@ -5038,8 +5193,10 @@ void CppGenerator::writeSetterFunction(TextStream &s,
     s << ";\n\n";
 
     if (fieldType.isPointerToWrapperType()) {
-        s << "Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(self), \""
-            << metaField.name() << "\", pyIn);\n";
+        s << "static const auto referenceKey = Shiboken::Object::referenceKey(\""
+            << metaField.name() << "\");\n"
+            << "Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(self), "
+            << "referenceKey, pyIn);\n";
     }
 
     s << "return 0;\n" << outdent << "}\n";
@@ -5193,7 +5350,8 @@ QByteArrayList CppGenerator::methodDefinitionParameters(const OverloadData &over
         result.append(max == 0 ? QByteArrayLiteral("METH_NOARGS")
                                : QByteArrayLiteral("METH_O"));
     } else {
-        result.append(QByteArrayLiteral("METH_VARARGS"));
+        result.append(usesFastCall(overloadData) ? QByteArrayLiteral("METH_FASTCALL")
+                                                 : QByteArrayLiteral("METH_VARARGS"));
         if (overloadData.hasArgumentWithDefaultValue())
             result.append(QByteArrayLiteral("METH_KEYWORDS"));
     }
@@ -6108,14 +6266,13 @@ void CppGenerator::writeGetattroDefinition(TextStream &s, const AbstractMetaClas
 
 QString CppGenerator::qObjectGetAttroFunction() const
 {
-    static QString result;
-    if (result.isEmpty()) {
+    static const QString result = [this]() {
         auto qobjectClass = AbstractMetaClass::findClass(api().classes(), qObjectT);
         Q_ASSERT(qobjectClass);
-        result = u"PySide::getHiddenDataFromQObject("_s
-                 + cpythonWrapperCPtr(qobjectClass, PYTHON_SELF_VAR)
-                 + u", self, name)"_s;
-    }
+        return u"PySide::getHiddenDataFromQObject("_s
+               + cpythonWrapperCPtr(qobjectClass, PYTHON_SELF_VAR)
+               + u", self, name)"_s;
+    }();
     return result;
 }
 
@@ -6228,31 +6385,205 @@ static void writeInitFuncDecl(TextStream &declStr,
     declStr << "PyTypeObject *" << functionName  << "(PyObject *enclosing);\n";
 }
 
-// Write declaration and invocation of the init function for the module init
-// function.
-void CppGenerator::writeInitFuncCall(TextStream &callStr,
-                                     const QString &functionName,
-                                     const TypeEntryCPtr &enclosingEntry,
-                                     const QString &pythonName, bool lazy)
+// Entry of the lazy type creation index of the module
+// (see Shiboken::Module::TypeCreationIndex).
+struct TypeCreationIndexEntry
+{
+    QString name; // Python name path, "Outer.Inner" for nested types
+    QString topLevelName;
+    QString function;
+    QString configCondition;
+};
+
+static TypeCreationIndexEntry typeCreationIndexEntry(const QString &functionName,
+                                                     const TypeEntryCPtr &enclosingEntry,
+                                                     const QString &pythonName,
+                                                     const QString &configCondition = {})
 {
     const bool hasParent = enclosingEntry && enclosingEntry->type() != TypeEntry::TypeSystemType;
-    if (!lazy) {
-        const QString enclosing = hasParent
-            ? "reinterpret_cast<PyObject *>("_L1 + cpythonTypeNameExt(enclosingEntry) + u')'
-            : "module"_L1;
-        callStr << functionName << '(' << enclosing << ");\n";
-    } else if (hasParent) {
-        const QString &enclosingName = enclosingEntry->name();
-        const auto parts = QStringView{enclosingName}.split(u"::", Qt::SkipEmptyParts);
-        const QString namePathPrefix = enclosingEntry->name().replace("::"_L1, "."_L1);
-        callStr << "Shiboken::Module::AddTypeCreationFunction("
-            << "module, \"" << parts[0] << "\", "
-            << functionName << ", \"" << namePathPrefix << '.' << pythonName << "\");\n";
-    } else {
-        callStr << "Shiboken::Module::AddTypeCreationFunction("
-            << "module, \"" << pythonName << "\", "
-            << functionName << ");\n";
+    if (!hasParent)
+        return {pythonName, pythonName, functionName, configCondition};
+    const QString &enclosingName = enclosingEntry->name();
+    const auto parts = QStringView{enclosingName}.split(u"::", Qt::SkipEmptyParts);
+    const QString namePathPrefix = enclosingEntry->name().replace("::"_L1, "."_L1);
+    return {namePathPrefix + u'.' + pythonName, parts.constFirst().toString(),
+            functionName, configCondition};
+}
+
+// Order the entries by top-level type, each followed by its nested types,
+// keeping the order of registration otherwise. Nested types of top-level
+// types of other modules follow as groups of their own.
+static QList<QList<TypeCreationIndexEntry>>
+    groupTypeCreationIndexEntries(const QList<TypeCreationIndexEntry> &entries)
+{
+    QList<QList<TypeCreationIndexEntry>> result;
+    QHash<QString, qsizetype> groupIndexes;
+    QList<TypeCreationIndexEntry> orphans;
+    for (const auto &entry : entries) {
+        if (entry.name == entry.topLevelName) {
+            const auto it = groupIndexes.constFind(entry.name);
+            if (it == groupIndexes.cend()) {
+                groupIndexes.insert(entry.name, result.size());
+                result.append({entry});
+            } else { // Like AddTypeCreationFunction(), the last one wins.
+                result[it.value()][0] = entry;
+            }
+        }
+    }
+    for (const auto &entry : entries) {
+        if (entry.name != entry.topLevelName) {
+            const auto it = groupIndexes.constFind(entry.topLevelName);
+            if (it != groupIndexes.cend())
+                result[it.value()].append(entry);
+            else
+                orphans.append(entry);
+        }
+    }
+    // Nested types whose top-level type belongs to another module
+    // are top-level entries named by their name path.
+    for (const auto &entry : std::as_const(orphans)) {
+        const auto it = groupIndexes.constFind(entry.name);
+        if (it == groupIndexes.cend()) {
+            groupIndexes.insert(entry.name, result.size());
+            result.append({entry});
+        } else {
+            result[it.value()][0] = entry;
+        }
+    }
+    return result;
+}
+
+// Seeded FNV-1a hash with the MurmurHash3 finalizer. Keep in sync with
+// typeNameHash() in libshiboken/sbkmodule.cpp.
+static quint32 typeNameHash(QByteArrayView name, quint32 seed)
+{
+    quint32 h = 2166136261U ^ seed;
+    for (const char c : name) {
+        h ^= quint8(c);
+        h *= 16777619U;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35U;
+    h ^= h >> 16;
+    return h;
+}
+
+struct PerfectHash
+{
+    QList<int> slotKeys;       // Key index per slot
+    QList<int> displacements;  // Displacement per bucket
+};
+
+// Compute a minimal perfect hash of unique keys by "hash, displace and
+// compress": The keys are distributed into buckets by typeNameHash(key, 0).
+// Starting with the largest bucket, a displacement (seed) is searched that
+// places all keys of a bucket into free slots. Single key buckets are
+// placed directly into the remaining free slots (stored as -slot - 1).
+static PerfectHash computePerfectHash(const QByteArrayList &keys)
+{
+    const auto size = quint32(keys.size());
+    QList<QList<int>> buckets(keys.size());
+    for (qsizetype k = 0, count = keys.size(); k < count; ++k)
+        buckets[typeNameHash(keys.at(k), 0) % size].append(int(k));
+    QList<int> bucketOrder(keys.size());
+    std::iota(bucketOrder.begin(), bucketOrder.end(), 0);
+    std::stable_sort(bucketOrder.begin(), bucketOrder.end(),
+                     [&buckets](int b1, int b2) {
+                         return buckets.at(b1).size() > buckets.at(b2).size();
+                     });
+
+    PerfectHash result{QList<int>(keys.size(), -1), QList<int>(keys.size(), 0)};
+    auto b = bucketOrder.cbegin();
+    QList<quint32> bucketSlots;
+    for (; b != bucketOrder.cend() && buckets.at(*b).size() > 1; ++b) {
+        const auto &bucket = buckets.at(*b);
+        for (quint32 displacement = 1; ; ++displacement) {
+            bucketSlots.clear();
+            for (int k : bucket) {
+                const quint32 slot = typeNameHash(keys.at(k), displacement) % size;
+                if (result.slotKeys.at(slot) != -1 || bucketSlots.contains(slot))
+                    break;
+                bucketSlots.append(slot);
+            }
+            if (bucketSlots.size() == bucket.size()) {
+                for (qsizetype i = 0; i < bucket.size(); ++i)
+                    result.slotKeys[bucketSlots.at(i)] = bucket.at(i);
+                result.displacements[*b] = int(displacement);
+                break;
+            }
+        }
+    }
+
+    qsizetype freeSlot = 0;
+    for (; b != bucketOrder.cend() && buckets.at(*b).size() == 1; ++b) {
+        while (result.slotKeys.at(freeSlot) != -1)
+            ++freeSlot;
+        result.slotKeys[freeSlot] = buckets.at(*b).constFirst();
+        result.displacements[*b] = -int(freeSlot) - 1;
+    }
+    return result;
+}
+
+static void writeIntArray(TextStream &s, const char *name, const QList<int> &values)
+{
+    s << "static const int " << name << "[] = {\n" << indent;
+    for (qsizetype i = 0, size = values.size(); i < size; ++i) {
+        s << values.at(i) << ',';
+        s << ((i % 16) == 15 || i == size - 1 ? '\n' : ' ');
     }
+    s << outdent << "};\n";
+}
+
+// Write the lazy type creation index, a minimal perfect hash of the
+// top-level type names.
+static void writeTypeCreationIndex(TextStream &s, const QList<TypeCreationIndexEntry> &entries)
+{
+    const auto groups = groupTypeCreationIndexEntries(entries);
+    QByteArrayList topLevelNames;
+    QList<int> topLevelEntries;
+    int entryCount = 0;
+    for (const auto &group : groups) {
+        topLevelNames.append(group.constFirst().name.toUtf8());
+        topLevelEntries.append(entryCount);
+        entryCount += int(group.size());
+    }
+    const PerfectHash hash = computePerfectHash(topLevelNames);
+
+    s << "// Lazy type creation index.\n"
+        << "static const Shiboken::Module::TypeCreationEntry typeCreationEntries[] = {\n"
+        << indent;
+    for (const auto &group : groups) {
+        for (qsizetype i = 0, size = group.size(); i < size; ++i) {
+            const auto &entry = group.at(i);
+            const auto nestedCount = i == 0 ? size - 1 : 0;
+            if (entry.configCondition.isEmpty()) {
+                s << "{\"" << entry.name << "\", " << entry.function << ", "
+                    << nestedCount << "},\n";
+            } else {
+                s << entry.configCondition << '\n'
+                    << "{\"" << entry.name << "\", " << entry.function << ", "
+                    << nestedCount << "},\n"
+                    << "#else\n"
+                    << "{\"" << entry.name << "\", nullptr, " << nestedCount << "},\n"
+                    << "#endif\n";
+            }
+        }
+    }
+    s << outdent << "};\n";
+
+    QList<int> slotEntries;
+    slotEntries.reserve(hash.slotKeys.size());
+    for (int key : hash.slotKeys)
+        slotEntries.append(topLevelEntries.at(key));
+    writeIntArray(s, "typeCreationSlots", slotEntries);
+    writeIntArray(s, "typeCreationDisplacements", hash.displacements);
+
+    s << "static const Shiboken::Module::TypeCreationIndex typeCreationIndex = {\n" << indent
+        << "typeCreationEntries, " << entryCount << ",\n"
+        << "typeCreationSlots, typeCreationDisplacements, " << topLevelNames.size() << '\n'
+        << outdent << "};\n\n";
 }
 
 static void writeSubModuleHandling(TextStream &s, const QString &moduleName,
@@ -6272,7 +6603,7 @@ bool CppGenerator::finishGeneration()
 {
     //Generate CPython wrapper file
     StringStream s_classInitDecl(TextStream::Language::Cpp);
-    StringStream s_classPythonDefines(TextStream::Language::Cpp);
+    QList<TypeCreationIndexEntry> typeCreationIndexEntries;
 
     std::set<Include> includes;
     StringStream s_globalFunctionImpl(TextStream::Language::Cpp);
@@ -6304,23 +6635,21 @@ bool CppGenerator::finishGeneration()
         auto te = cls->typeEntry();
         if (shouldGenerate(te)) {
             const bool hasConfigCondition = te->hasConfigCondition();
-            if (hasConfigCondition) {
+            if (hasConfigCondition)
                 s_classInitDecl << te->configCondition() << '\n';
-                s_classPythonDefines << te->configCondition() << '\n';
-            }
             const QString initFunc = initFuncPrefix + getSimpleClassInitFunctionName(cls);
             writeInitFuncDecl(s_classInitDecl, initFunc);
-            writeInitFuncCall(s_classPythonDefines, initFunc,
-                              targetLangEnclosingEntry(te), cls->name());
+            typeCreationIndexEntries.append(typeCreationIndexEntry(initFunc,
+                                                                   targetLangEnclosingEntry(te),
+                                                                   cls->name(),
+                                                                   te->configCondition()));
             if (cls->hasStaticFields()) {
                 s_classInitDecl << "PyTypeObject *"
                     << getSimpleClassStaticFieldsInitFunctionName(cls) << "(PyObject *module);\n";
                 classesWithStaticFields.append(cls);
             }
-            if (hasConfigCondition) {
+            if (hasConfigCondition)
                 s_classInitDecl << "#endif\n";
-                s_classPythonDefines << "#endif\n";
-            }
         }
     }
 
@@ -6332,8 +6661,8 @@ bool CppGenerator::finishGeneration()
 
         const QString initFunc = initFuncPrefix + getInitFunctionName(context);
         writeInitFuncDecl(s_classInitDecl, initFunc);
-        writeInitFuncCall(s_classPythonDefines,
-                          initFunc, enclosingTypeEntry, smp.specialized->name());
+        typeCreationIndexEntries.append(typeCreationIndexEntry(initFunc, enclosingTypeEntry,
+                                                               smp.specialized->name()));
         includes.insert(smp.type.instantiations().constFirst().typeEntry()->include());
     }
 
@@ -6544,6 +6873,9 @@ bool CppGenerator::finishGeneration()
 
     writeInitInheritance(s);
 
+    if (!typeCreationIndexEntries.isEmpty())
+        writeTypeCreationIndex(s, typeCreationIndexEntries);
+
     // Write module init function
     const QString globalModuleVar = pythonModuleObjectName();
     s << "extern \"C\" LIBSHIBOKEN_EXPORT PyObject *PyInit_"
@@ -6601,16 +6933,23 @@ bool CppGenerator::finishGeneration()
         << "_CONVERTERS_IDX_COUNT" << "];\n"
         << convertersVariableName() << " = sbkConverters;\n\n"
         << "PyObject *module = Shiboken::Module::create(\""  << moduleName()
-        << "\", &moduledef);\n\n"
-        << "// Make module available from global scope\n"
+        << "\", &moduledef);\n\n";
+    if (freeThreading()) {
+        s << "#ifdef Py_GIL_DISABLED\n"
+            << "PyUnstable_Module_SetGIL(module, Py_MOD_GIL_NOT_USED);\n"
+            << "#endif\n\n";
+    }
+    s << "// Make module available from global scope\n"
         << globalModuleVar << " = module;\n\n";
 
     const QString subModuleOf = typeDb->defaultTypeSystemType()->subModuleOf();
     if (!subModuleOf.isEmpty())
         writeSubModuleHandling(s,  moduleName(), subModuleOf);
 
-    s << "// Initialize classes in the type system\n"
-        << s_classPythonDefines.toString();
+    if (!typeCreationIndexEntries.isEmpty()) {
+        s << "// Initialize classes in the type system\n"
+            << "Shiboken::Module::AddTypeCreationIndex(module, &typeCreationIndex);\n";
+    }
 
     if (!typeConversions.isEmpty()) {
         s << '\n';
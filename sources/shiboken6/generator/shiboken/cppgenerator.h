@@ -63,10 +63,6 @@ private:
     void generateIncludes(TextStream &s, const GeneratorContext &classContext,
                           const IncludeGroupList &includes = {},
                           const AbstractMetaClassCList &innerClasses = {}) const;
-    static void writeInitFuncCall(TextStream &callStr,
-                                  const QString &functionName,
-                                  const TypeEntryCPtr &enclosingEntry,
-                                  const QString &pythonName, bool lazy = true);
     static void writeCacheResetNative(TextStream &s, const GeneratorContext &classContext);
     void writeConstructorNative(TextStream &s, const GeneratorContext &classContext,
                                 const AbstractMetaFunctionCPtr &func) const;
@@ -297,6 +293,9 @@ private:
     void writeOverloadedFunctionDecisorEngine(TextStream &s,
                                               const OverloadData &overloadData,
                                               const OverloadDataRootNode *node) const;
+    bool usesOverloadCache(const OverloadData &overloadData) const;
+    bool hasTypeDeterminedChecks(const OverloadDataRootNode *node) const;
+    bool isTypeDeterminedCheck(const AbstractMetaType &type, int depth = 0) const;
 
     /// Writes calls to all the possible method/function overloads.
     void writeFunctionCalls(TextStream &s,
@@ -415,7 +414,7 @@ private:
                                                const AbstractMetaClassCPtr &metaClass);
     void writeClassDefinition(TextStream &s,
                               const AbstractMetaClassCPtr &metaClass,
-                              const GeneratorContext &classContext);
+                              const GeneratorContext &classContext) const;
     QByteArrayList methodDefinitionParameters(const OverloadData &overloadData) const;
     QList<PyMethodDefEntry> methodDefinitionEntries(const OverloadData &overloadData) const;
 
@@ -436,7 +435,8 @@ private:
                              const AbstractMetaClassCPtr &metaClass,
                              const GeneratorContext &context) const;
 
-    void writeTypeAsNumberDefinition(TextStream &s, const AbstractMetaClassCPtr &metaClass) const;
+    void writeTypeAsNumberDefinition(TextStream &s, const AbstractMetaClassCPtr &metaClass,
+                                     const QHash<QString, QString> &nbSlotFunctions) const;
 
     static void writeTpTraverseFunction(TextStream &s, const AbstractMetaClassCPtr &metaClass);
     static void writeTpClearFunction(TextStream &s, const AbstractMetaClassCPtr &metaClass);
@@ -559,13 +559,9 @@ private:
     static bool hasBoolCast(const AbstractMetaClassCPtr &metaClass)
     { return boolCast(metaClass).has_value(); }
 
-    void clearTpFuncs();
     static QString chopType(QString s);
 
     static QString typeInitStructHelper(const TypeEntryCPtr &te, const QString &varName);
-
-    QHash<QString, QString> m_tpFuncs;
-    QHash<QString, QString> m_nbFuncs;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(CppGenerator::CppSelfDefinitionFlags)
@@ -7,7 +7,6 @@
 #include <typesystem.h>
 
 #include <QtCore/QDebug>
-#include <QtCore/QSet>
 
 static bool isCppPrimitiveString(const AbstractMetaType &type)
 {
@@ -45,12 +44,9 @@ GeneratorArgument GeneratorArgument::fromMetaType(const AbstractMetaType &type)
             if (nestedArrayTypes.constLast().isCppPrimitive()) {
                 result.type = Type::CppPrimitiveArray;
             } else {
-                static QSet<QString> warnedTypes;
-                const QString &signature = type.cppSignature();
-                if (!warnedTypes.contains(signature)) {
-                    warnedTypes.insert(signature);
-                    qWarning("%s", qPrintable(msgUnknownArrayPointerConversion(signature)));
-                }
+                // Repeated warnings are suppressed by ReportHandler, which
+                // keeps the output deterministic when generating concurrently.
+                qWarning("%s", qPrintable(msgUnknownArrayPointerConversion(type.cppSignature())));
                 result.indirections -= 1;
             }
         }
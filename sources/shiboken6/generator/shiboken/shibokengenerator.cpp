@@ -43,6 +43,7 @@
 
 #include <QtCore/QDir>
 #include <QtCore/QDebug>
+#include <QtCore/QRecursiveMutex>
 #include <QtCore/QRegularExpression>
 
 #include <algorithm>
@@ -63,6 +64,9 @@ static constexpr auto USE_OPERATOR_BOOL_AS_NB_NONZERO = "use-operator-bool-as-nb
 static constexpr auto WRAPPER_DIAGNOSTICS = "wrapper-diagnostics"_L1;
 static constexpr auto NO_IMPLICIT_CONVERSIONS = "no-implicit-conversions"_L1;
 static constexpr auto LEAN_HEADERS = "lean-headers"_L1;
+static constexpr auto USE_FASTCALL = "use-fastcall"_L1;
+static constexpr auto USE_OVERLOAD_CACHE = "use-overload-cache"_L1;
+static constexpr auto FREE_THREADING = "free-threading"_L1;
 
 QString CPP_ARG_N(int i)
 {
@@ -100,6 +104,9 @@ struct ShibokenGeneratorOptions
     // FIXME PYSIDE 7 Flip generateImplicitConversions default or remove?
     bool generateImplicitConversions = true;
     bool wrapperDiagnostics = false;
+    bool useFastCall = false;
+    bool useOverloadCache = false;
+    bool freeThreading = false;
 };
 
 struct GeneratorClassInfoCacheEntry
@@ -110,10 +117,15 @@ struct GeneratorClassInfoCacheEntry
     bool needsGetattroFunction = false;
 };
 
-using GeneratorClassInfoCache = QHash<AbstractMetaClassCPtr, GeneratorClassInfoCacheEntry>;
+using GeneratorClassInfoCacheEntryPtr = std::shared_ptr<GeneratorClassInfoCacheEntry>;
+using GeneratorClassInfoCache = QHash<AbstractMetaClassCPtr, GeneratorClassInfoCacheEntryPtr>;
 
 Q_GLOBAL_STATIC(GeneratorClassInfoCache, generatorClassInfoCache)
 
+// Classes are generated concurrently. The mutex is recursive since filling
+// an entry queries the function groups of the same class.
+static QRecursiveMutex generatorClassInfoCacheMutex;
+
 static const char CHECKTYPE_REGEX[] = R"(%CHECKTYPE\[([^\[]*)\]\()";
 static const char ISCONVERTIBLE_REGEX[] = R"(%ISCONVERTIBLE\[([^\[]*)\]\()";
 static const char CONVERTTOPYTHON_REGEX[] = R"(%CONVERTTOPYTHON\[([^\[]*)\]\()";
@@ -2047,17 +2059,19 @@ ShibokenGenerator::FunctionGroups ShibokenGenerator::getGlobalFunctionGroups() c
 const GeneratorClassInfoCacheEntry &
     ShibokenGenerator::getGeneratorClassInfo(const AbstractMetaClassCPtr &scope)
 {
+    QMutexLocker locker(&generatorClassInfoCacheMutex);
     auto *cache = generatorClassInfoCache();
-    auto it = cache->find(scope);
-    if (it == cache->end()) {
-        it = cache->insert(scope, {});
-        auto &entry = it.value();
-        entry.functionGroups = getFunctionGroupsImpl(scope);
-        entry.needsGetattroFunction = classNeedsGetattroFunctionImpl(scope);
-        entry.numberProtocolOperators = getNumberProtocolOperators(scope);
-        entry.boolCastFunctionO = getBoolCast(scope);
-    }
-    return it.value();
+    auto it = cache->constFind(scope);
+    if (it != cache->cend())
+        return *it.value();
+    // Insert before filling, the entry may be queried recursively.
+    auto entry = std::make_shared<GeneratorClassInfoCacheEntry>();
+    cache->insert(scope, entry);
+    entry->functionGroups = getFunctionGroupsImpl(scope);
+    entry->needsGetattroFunction = classNeedsGetattroFunctionImpl(scope);
+    entry->numberProtocolOperators = getNumberProtocolOperators(scope);
+    entry->boolCastFunctionO = getBoolCast(scope);
+    return *entry;
 }
 
 ShibokenGenerator::FunctionGroups
@@ -2366,7 +2380,15 @@ QList<OptionDescription> ShibokenGenerator::options()
         {NO_IMPLICIT_CONVERSIONS,
          u"Do not generate implicit_conversions for function arguments."_s},
         {WRAPPER_DIAGNOSTICS,
-         u"Generate diagnostic code around wrappers"_s}
+         u"Generate diagnostic code around wrappers"_s},
+        {USE_FASTCALL,
+         u"Use the METH_FASTCALL calling convention for functions\n"
+          "taking several arguments (requires Python 3.10 for the limited API)"_s},
+        {USE_OVERLOAD_CACHE,
+         u"Cache the overload chosen for the argument types of overloaded functions"_s},
+        {FREE_THREADING,
+         u"Declare the module as not using the GIL on free-threaded Python builds\n"
+          "(only for modules whose injected code has been checked for thread safety)"_s}
     };
 }
 
@@ -2405,6 +2427,12 @@ bool ShibokenGeneratorOptionsParser::handleBoolOption(const QString &key, Option
     }
     if (key == WRAPPER_DIAGNOSTICS)
         return (m_options->wrapperDiagnostics = true);
+    if (key == USE_FASTCALL)
+        return (m_options->useFastCall = true);
+    if (key == USE_OVERLOAD_CACHE)
+        return (m_options->useOverloadCache = true);
+    if (key == FREE_THREADING)
+        return (m_options->freeThreading = true);
     return false;
 }
 
@@ -2418,6 +2446,12 @@ bool ShibokenGenerator::doSetup()
     return true;
 }
 
+// The generated wrappers of the classes are independent of each other.
+bool ShibokenGenerator::supportsConcurrentGeneration() const
+{
+    return true;
+}
+
 bool ShibokenGenerator::useCtorHeuristic()
 {
     return m_options.useCtorHeuristic;
@@ -2448,6 +2482,21 @@ bool ShibokenGenerator::generateImplicitConversions()
     return m_options.generateImplicitConversions;
 }
 
+bool ShibokenGenerator::useFastCall()
+{
+    return m_options.useFastCall;
+}
+
+bool ShibokenGenerator::useOverloadCache()
+{
+    return m_options.useOverloadCache;
+}
+
+bool ShibokenGenerator::freeThreading()
+{
+    return m_options.freeThreading;
+}
+
 QString ShibokenGenerator::moduleCppPrefix(const QString &moduleName)
  {
     QString result = moduleName.isEmpty() ? packageName() : moduleName;
@@ -99,6 +99,7 @@ public:
 
 protected:
     bool doSetup() override;
+    bool supportsConcurrentGeneration() const override;
 
     GeneratorContext contextForClass(const AbstractMetaClassCPtr &c) const override;
 
@@ -314,6 +315,12 @@ protected:
     static bool useOperatorBoolAsNbBool();
     /// Generate implicit conversions of function arguments
     static bool generateImplicitConversions();
+    /// Use METH_FASTCALL for functions taking a list of arguments
+    static bool useFastCall();
+    /// Cache the decisions of the overload decisor by argument types
+    static bool useOverloadCache();
+    /// Declare the module as not using the GIL on free-threaded builds
+    static bool freeThreading();
     static QString cppApiVariableNameOld(const QString &moduleName = {});
     static QString cppApiVariableName(const QString &moduleName = QString());
     static QString pythonModuleObjectName(const QString &moduleName = QString());
@@ -9,6 +9,8 @@
 #include "sbkconverter.h"
 #include "sbkerrors.h"
 #include "sbkfeature_base.h"
+#include "sbkmutex.h"
+#include "sbkoverloadcache.h"
 #include "sbkstring.h"
 #include "sbkstaticstrings.h"
 #include "sbkstaticstrings_p.h"
@@ -19,8 +21,12 @@
 #include <cstring>
 #include <cstddef>
 #include <set>
+#include <unordered_set>
+#include <vector>
 #include <sstream>
 #include <algorithm>
+#include <cassert>
+#include <mutex>
 #include "threadstatesaver.h"
 #include "signature.h"
 #include "signature_p.h"
@@ -38,6 +44,143 @@ namespace {
     void _destroyParentInfo(SbkObject *obj, bool keepReference);
 }
 
+// The parent/child ownership trees span several wrappers and are protected
+// by a global lock on free-threaded builds. References to wrappers are
+// released only after unlocking since deallocating a wrapper runs Python
+// code which may modify the trees in turn.
+#ifdef Py_GIL_DISABLED
+static Shiboken::RecursiveMutex ownershipMutex;
+static thread_local int ownershipLockDepth = 0;
+static thread_local std::vector<PyObject *> ownershipDeferredDecRefs;
+#endif
+
+class OwnershipLocker
+{
+public:
+    OwnershipLocker(const OwnershipLocker &) = delete;
+    OwnershipLocker &operator=(const OwnershipLocker &) = delete;
+    OwnershipLocker(OwnershipLocker &&) = delete;
+    OwnershipLocker &operator=(OwnershipLocker &&) = delete;
+
+#ifdef Py_GIL_DISABLED
+    OwnershipLocker()
+    {
+        if (!ownershipMutex.try_lock()) {
+            Py_BEGIN_ALLOW_THREADS
+            ownershipMutex.lock();
+            Py_END_ALLOW_THREADS
+        }
+        ++ownershipLockDepth;
+    }
+
+    ~OwnershipLocker()
+    {
+        const bool outermost = --ownershipLockDepth == 0;
+        ownershipMutex.unlock();
+        while (outermost && !ownershipDeferredDecRefs.empty()) {
+            std::vector<PyObject *> decRefs;
+            decRefs.swap(ownershipDeferredDecRefs);
+            for (auto *obj : decRefs)
+                Py_DECREF(obj);
+        }
+    }
+#else
+    OwnershipLocker() noexcept {}
+#endif
+};
+
+// Release a reference held by the ownership trees.
+static inline void ownershipDecRef(SbkObject *obj)
+{
+    auto *pyObj = reinterpret_cast<PyObject *>(obj);
+#ifdef Py_GIL_DISABLED
+    if (ownershipLockDepth > 0) {
+        ownershipDeferredDecRefs.push_back(pyObj);
+        return;
+    }
+#endif
+    Py_DECREF(pyObj);
+}
+
+// Free list pool for the fixed size structures allocated per wrapper
+// (SbkObjectPrivate, ParentInfo). Blocks are carved from chunks which are
+// kept for reuse instead of being returned to the system.
+template <class T>
+class WrapperDataPool
+{
+public:
+    static WrapperDataPool *instance()
+    {
+        static auto *pool = new WrapperDataPool; // Not deleted, used at exit
+        return pool;
+    }
+
+    void *allocate()
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        if (m_freeList == nullptr)
+            addChunk();
+        Block *block = m_freeList;
+        m_freeList = block->next;
+        return block->storage;
+    }
+
+    void release(void *p) noexcept
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        auto *block = reinterpret_cast<Block *>(p);
+        block->next = m_freeList;
+        m_freeList = block;
+    }
+
+private:
+    union Block
+    {
+        Block *next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static constexpr std::size_t blocksPerChunk = 512;
+
+    void addChunk()
+    {
+        auto *chunk = new Block[blocksPerChunk];
+        m_chunks.push_back(chunk);
+        for (std::size_t i = 0; i < blocksPerChunk; ++i) {
+            chunk[i].next = m_freeList;
+            m_freeList = chunk + i;
+        }
+    }
+
+    std::vector<Block *> m_chunks;
+    Block *m_freeList = nullptr;
+    std::mutex m_mutex;
+};
+
+void *SbkObjectPrivate::operator new([[maybe_unused]] std::size_t size)
+{
+    assert(size == sizeof(SbkObjectPrivate));
+    return WrapperDataPool<SbkObjectPrivate>::instance()->allocate();
+}
+
+void SbkObjectPrivate::operator delete(void *p) noexcept
+{
+    if (p != nullptr)
+        WrapperDataPool<SbkObjectPrivate>::instance()->release(p);
+}
+
+void *Shiboken::ParentInfo::operator new([[maybe_unused]] std::size_t size)
+{
+    assert(size == sizeof(Shiboken::ParentInfo));
+    return WrapperDataPool<Shiboken::ParentInfo>::instance()->allocate();
+}
+
+void Shiboken::ParentInfo::operator delete(void *p) noexcept
+{
+    if (p != nullptr)
+        WrapperDataPool<Shiboken::ParentInfo>::instance()->release(p);
+}
+
 namespace Shiboken
 {
 // Walk through the first level of non-user-type Sbk base classes relevant for
@@ -195,11 +338,24 @@ static PyGetSetDef SbkObjectType_tp_getset[] = {
     {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
 };
 
+// Setting an attribute on a type may add or remove a Python override of
+// a virtual method or change the result of type checks (__bases__, number
+// protocol); invalidate the cache of BindingManager::getOverride() and the
+// overload caches.
+static int SbkObjectType_tp_setattro(PyObject *type, PyObject *name, PyObject *value)
+{
+    static setattrofunc const type_setattro = PepExt_Type_GetSetAttroSlot(&PyType_Type);
+    Shiboken::BindingManager::instance().clearOverrideCache();
+    Shiboken::OverloadCache::invalidate();
+    return type_setattro(type, name, value);
+}
+
 static PyTypeObject *createObjectTypeType()
 {
     PyType_Slot SbkObjectType_Type_slots[] = {
         {Py_tp_dealloc, reinterpret_cast<void *>(SbkObjectType_tp_dealloc)},
         {Py_tp_getattro, reinterpret_cast<void *>(mangled_type_getattro)},
+        {Py_tp_setattro, reinterpret_cast<void *>(SbkObjectType_tp_setattro)},
         {Py_tp_base, static_cast<void *>(&PyType_Type)},
         {Py_tp_alloc, reinterpret_cast<void *>(PyType_GenericAlloc)},
         {Py_tp_new, reinterpret_cast<void *>(SbkObjectType_tp_new)},
@@ -500,7 +656,10 @@ void SbkObjectType_tp_dealloc(PyTypeObject *sbkType)
         }
         free(sotp->original_name);
         sotp->original_name = nullptr;
-        if (!Shiboken::ObjectType::isUserType(sbkType))
+        Shiboken::OverloadCache::invalidate(); // Type address may be reused
+        if (Shiboken::ObjectType::isUserType(sbkType))
+            Shiboken::BindingManager::instance().clearOverrideCache(); // Type address may be reused
+        else
             Shiboken::Conversions::deleteConverter(sotp->converter);
         PepType_SOTP_delete(sbkType);
     }
@@ -661,8 +820,7 @@ static PyObject *_setupNew(PyObject *obSelf, PyTypeObject *subtype)
     auto *sotp = PepType_SOTP(sbkSubtype);
     int numBases = ((sotp && sotp->is_multicpp) ?
         Shiboken::getNumberOfCppBaseClasses(subtype) : 1);
-    d->cptr = new void *[numBases];
-    std::memset(d->cptr, 0, sizeof(void *) *size_t(numBases));
+    d->allocateCppPointers(numBases);
     d->hasOwnership = 1;
     d->containsCppWrapper = 0;
     d->validCppObject = 0;
@@ -744,6 +902,7 @@ namespace
 
 void _destroyParentInfo(SbkObject *obj, bool keepReference)
 {
+    OwnershipLocker locker;
     Shiboken::ParentInfo *pInfo = obj->d->parentInfo;
     if (pInfo) {
         while(!pInfo->children.empty()) {
@@ -887,6 +1046,54 @@ PyObject *checkInvalidArgumentCount(Py_ssize_t numArgs, Py_ssize_t minArgs, Py_s
     return result;
 }
 
+bool unpackFastCallArguments(PyObject *const *args, Py_ssize_t nargs,
+                             const char *funcName,
+                             Py_ssize_t minArgs, Py_ssize_t maxArgs,
+                             PyObject **pyArgs)
+{
+    if (nargs < minArgs || nargs > maxArgs) {
+        const bool tooFew = nargs < minArgs;
+        const Py_ssize_t expected = tooFew ? minArgs : maxArgs;
+        PyErr_Format(PyExc_TypeError, "%s expected %s%zd argument%s, got %zd",
+                     funcName, minArgs == maxArgs ? "" : (tooFew ? "at least " : "at most "),
+                     expected, expected == 1 ? "" : "s", nargs);
+        return false;
+    }
+    std::copy(args, args + nargs, pyArgs);
+    return true;
+}
+
+PyObject *fastCallArgumentsToTuple(PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *result = PyTuple_New(nargs);
+    if (result == nullptr)
+        return nullptr;
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
+        Py_INCREF(args[i]);
+        PyTuple_SetItem(result, i, args[i]);
+    }
+    return result;
+}
+
+PyObject *fastCallKeywordsToDict(PyObject *const *kwValues, PyObject *kwNames)
+{
+    if (kwNames == nullptr)
+        return nullptr;
+    const Py_ssize_t size = PyTuple_Size(kwNames);
+    if (size == 0)
+        return nullptr;
+    PyObject *result = PyDict_New();
+    if (result == nullptr)
+        return nullptr;
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        if (PyDict_SetItem(result, PyTuple_GetItem(kwNames, i), kwValues[i]) < 0) {
+            Py_DECREF(result);
+            return nullptr;
+        }
+    }
+    return result;
+}
+
 std::vector<SbkObject *> splitPyObject(PyObject *pyObj)
 {
     std::vector<SbkObject *> result;
@@ -905,13 +1112,6 @@ std::vector<SbkObject *> splitPyObject(PyObject *pyObj)
     return result;
 }
 
-template <class Iterator>
-inline void decRefPyObjectList(Iterator i1, Iterator i2)
-{
-    for (; i1 != i2; ++i1)
-        Py_DECREF(i1->second);
-}
-
 namespace ObjectType
 {
 
@@ -1103,7 +1303,10 @@ bool canDowncastTo(PyTypeObject *baseType, PyTypeObject *targetType)
 namespace Object
 {
 
-static void recursive_invalidate(SbkObject *self, std::set<SbkObject *>& seen);
+// Wrappers visited by invalidate(). The storage is reused by releaseChildren().
+using VisitedWrappers = std::unordered_set<SbkObject *>;
+
+static void recursive_invalidate(SbkObject *self, VisitedWrappers &seen);
 
 bool checkType(PyObject *pyObj)
 {
@@ -1202,8 +1405,7 @@ void callCppDestructors(SbkObject *pyObj)
        invalidate doesn't */
     invalidate(pyObj);
 
-    delete[] priv->cptr;
-    priv->cptr = nullptr;
+    priv->releaseCppPointers();
     priv->validCppObject = false;
 }
 
@@ -1214,6 +1416,7 @@ bool hasOwnership(SbkObject *pyObj)
 
 void getOwnership(SbkObject *self)
 {
+    OwnershipLocker locker;
     // skip if already have the ownership
     if (self->d->hasOwnership)
         return;
@@ -1226,7 +1429,7 @@ void getOwnership(SbkObject *self)
     self->d->hasOwnership = true;
 
     if (self->d->containsCppWrapper)
-        Py_DECREF(reinterpret_cast<PyObject *>(self)); // Remove extra ref
+        ownershipDecRef(self); // Remove extra ref
     else
         makeValid(self); // Make the object valid again
 }
@@ -1260,39 +1463,86 @@ void releaseOwnership(PyObject *self)
 }
 
 /* Needed forward declarations */
-static void recursive_invalidate(PyObject *pyobj, std::set<SbkObject *>& seen);
-static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen);
+static void recursive_invalidate(PyObject *pyobj, VisitedWrappers &seen);
+static void recursive_invalidate(SbkObject *self, VisitedWrappers &seen);
+
+static void invalidateWrapper(SbkObject *self)
+{
+    if (!self->d->containsCppWrapper) {
+        self->d->validCppObject = false; // Mark object as invalid only if this is not a wrapper class
+        BindingManager::instance().releaseWrapper(self);
+    }
+}
+
+// Objects without children and references (items of views, etc.) do not
+// need the bookkeeping of visited objects.
+static bool isLeafWrapper(const SbkObject *self)
+{
+    const auto *pInfo = self->d->parentInfo;
+    const auto *rInfo = self->d->referredObjects;
+    return (pInfo == nullptr || pInfo->children.empty()) && (rInfo == nullptr || rInfo->empty());
+}
 
 void invalidate(PyObject *pyobj)
 {
-    std::set<SbkObject *> seen;
+    OwnershipLocker locker;
+    VisitedWrappers seen;
     recursive_invalidate(pyobj, seen);
 }
 
 void invalidate(SbkObject *self)
 {
-    std::set<SbkObject *> seen;
+    OwnershipLocker locker;
+    if (self != nullptr && reinterpret_cast<PyObject *>(self) != Py_None && isLeafWrapper(self)) {
+        invalidateWrapper(self);
+        return;
+    }
+    VisitedWrappers seen;
     recursive_invalidate(self, seen);
 }
 
-static void recursive_invalidate(PyObject *pyobj, std::set<SbkObject *> &seen)
+void releaseChildren(const void *const *cppObjects, std::size_t count, unsigned flags)
+{
+    auto &bindingManager = BindingManager::instance();
+    OwnershipLocker locker;
+    VisitedWrappers seen;
+    for (std::size_t i = 0; i < count; ++i) {
+        // Look up each wrapper only now since releasing the previous
+        // ones may have deleted it.
+        SbkObject *wrapper = bindingManager.retrieveWrapper(cppObjects[i]);
+        if (wrapper == nullptr)
+            continue;
+        auto *pyObj = reinterpret_cast<PyObject *>(wrapper);
+        const bool invalidateIt = (flags & InvalidateChildren) != 0
+            || ((flags & InvalidateReferencedChildren) != 0 && Py_REFCNT(pyObj) > 1);
+        Py_INCREF(pyObj);
+        if (invalidateIt) {
+            if (isLeafWrapper(wrapper)) {
+                invalidateWrapper(wrapper);
+            } else {
+                seen.clear();
+                recursive_invalidate(wrapper, seen);
+            }
+        }
+        removeParent(wrapper);
+        ownershipDecRef(wrapper);
+    }
+}
+
+static void recursive_invalidate(PyObject *pyobj, VisitedWrappers &seen)
 {
     const auto objs = splitPyObject(pyobj);
     for (SbkObject *o : objs)
         recursive_invalidate(o, seen);
 }
 
-static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen)
+static void recursive_invalidate(SbkObject *self, VisitedWrappers &seen)
 {
     // Skip if this object not is a valid object or if it's already been seen
-    if (!self || reinterpret_cast<PyObject *>(self) == Py_None || seen.find(self) != seen.end())
+    if (!self || reinterpret_cast<PyObject *>(self) == Py_None || !seen.insert(self).second)
         return;
-    seen.insert(self);
 
-    if (!self->d->containsCppWrapper) {
-        self->d->validCppObject = false; // Mark object as invalid only if this is not a wrapper class
-        BindingManager::instance().releaseWrapper(self);
-    }
+    invalidateWrapper(self);
 
     // If it is a parent invalidate all children.
     if (self->d->parentInfo) {
@@ -1322,6 +1572,8 @@ void makeValid(SbkObject *self)
     if (!self || reinterpret_cast<PyObject *>(self) == Py_None || self->d->validCppObject)
         return;
 
+    OwnershipLocker locker;
+
     // Mark object as invalid only if this is not a wrapper class
     self->d->validCppObject = true;
 
@@ -1448,6 +1700,7 @@ SbkObject *findColocatedChild(SbkObject *wrapper,
     if (!(wrapper->d && wrapper->d->cptr))
         return nullptr;
 
+    OwnershipLocker locker;
     ParentInfo *pInfo = wrapper->d->parentInfo;
     if (!pInfo)
         return nullptr;
@@ -1581,6 +1834,7 @@ void destroy(SbkObject *self, void *cppData)
     clearReferences(self);
 
     // Remove the object from parent control
+    OwnershipLocker locker;
 
     // Verify if this object has parent
     bool hasParent = (self->d->parentInfo && self->d->parentInfo->parent);
@@ -1595,7 +1849,7 @@ void destroy(SbkObject *self, void *cppData)
     if (!hasParent && self->d->containsCppWrapper && !self->d->hasOwnership) {
         // Remove extra ref used by c++ object this will case the pyobject destruction
         // This can cause the object death
-        Py_DECREF(reinterpret_cast<PyObject *>(self));
+        ownershipDecRef(self);
     }
 
     //Python Object is not destroyed yet
@@ -1605,15 +1859,36 @@ void destroy(SbkObject *self, void *cppData)
         self->d->hasOwnership = false;
 
         // the cpp object instance was deleted
-        delete[] self->d->cptr;
-        self->d->cptr = nullptr;
+        self->d->releaseCppPointers();
     }
 
     // After this point the object can be death do not use the self pointer bellow
 }
 
+// The position of a child in the children list of the parent is stored in
+// its ParentInfo so that it can be removed without searching.
+static void appendChild(ParentInfo *parentInfo, SbkObject *child)
+{
+    child->d->parentInfo->indexInParent = parentInfo->children.size();
+    parentInfo->children.push_back(child);
+}
+
+static bool removeChild(ParentInfo *parentInfo, SbkObject *child)
+{
+    auto &children = parentInfo->children;
+    const std::size_t index = child->d->parentInfo->indexInParent;
+    if (index >= children.size() || children[index] != child)
+        return false;
+    SbkObject *last = children.back();
+    children[index] = last;
+    last->d->parentInfo->indexInParent = index;
+    children.pop_back();
+    return true;
+}
+
 void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
 {
+    OwnershipLocker locker;
     ParentInfo *pInfo = child->d->parentInfo;
     if (!pInfo || !pInfo->parent) {
         if (pInfo && pInfo->hasWrapperRef) {
@@ -1622,14 +1897,10 @@ void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
         return;
     }
 
-    ChildrenList &oldBrothers = pInfo->parent->d->parentInfo->children;
     // Verify if this child is part of parent list
-    auto iChild = oldBrothers.find(child);
-    if (iChild == oldBrothers.end())
+    if (!removeChild(pInfo->parent->d->parentInfo, child))
         return;
 
-    oldBrothers.erase(iChild);
-
     pInfo->parent = nullptr;
 
     // This will keep the wrapper reference, will wait for wrapper destruction to remove that
@@ -1637,7 +1908,7 @@ void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
         child->d->containsCppWrapper) {
         //If have already a extra ref remove this one
         if (pInfo->hasWrapperRef)
-            Py_DECREF(child);
+            ownershipDecRef(child);
         else
             pInfo->hasWrapperRef = true;
         return;
@@ -1647,7 +1918,7 @@ void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
     child->d->hasOwnership = giveOwnershipBack;
 
     // Remove parent ref
-    Py_DECREF(child);
+    ownershipDecRef(child);
 }
 
 void setParent(PyObject *parent, PyObject *child)
@@ -1676,6 +1947,8 @@ void setParent(PyObject *parent, PyObject *child)
     auto parent_ = reinterpret_cast<SbkObject *>(parent);
     auto child_ = reinterpret_cast<SbkObject *>(child);
 
+    OwnershipLocker locker;
+
     if (!parentIsNull) {
         if (!parent_->d->parentInfo)
             parent_->d->parentInfo = new ParentInfo;
@@ -1702,7 +1975,7 @@ void setParent(PyObject *parent, PyObject *child)
             pInfo = child_->d->parentInfo = new ParentInfo;
 
         pInfo->parent = parent_;
-        parent_->d->parentInfo->children.insert(child_);
+        appendChild(parent_->d->parentInfo, child_);
 
         // Add Parent ref
         Py_INCREF(child_);
@@ -1712,7 +1985,7 @@ void setParent(PyObject *parent, PyObject *child)
     }
 
     // Remove previous safe ref
-    Py_DECREF(child);
+    ownershipDecRef(child_);
 }
 
 void deallocData(SbkObject *self, bool cleanup)
@@ -1730,8 +2003,7 @@ void deallocData(SbkObject *self, bool cleanup)
     if (self->d->cptr) {
         // Remove from BindingManager
         Shiboken::BindingManager::instance().releaseWrapper(self);
-        delete[] self->d->cptr;
-        self->d->cptr = nullptr;
+        self->d->releaseCppPointers();
         // delete self->d; PYSIDE-205: wrong!
     }
     delete self->d; // PYSIDE-205: always delete d.
@@ -1761,57 +2033,108 @@ static inline bool isNone(const PyObject *o)
     return o == nullptr || o == Py_None;
 }
 
-static void removeRefCountKey(SbkObject *self, const std::string &key)
+// Interned keys of keepReference()
+struct ReferenceKeys
+{
+    std::mutex mutex;
+    std::unordered_map<std::string, ReferenceKey> keys;
+    std::vector<std::string> names;
+};
+
+static ReferenceKeys &referenceKeys()
+{
+    static auto *result = new ReferenceKeys; // Not deleted, used at exit
+    return *result;
+}
+
+ReferenceKey referenceKey(const char *keyC)
+{
+    auto &referenceKeys = Object::referenceKeys();
+    std::lock_guard<std::mutex> locker(referenceKeys.mutex);
+    auto it = referenceKeys.keys.find(keyC);
+    if (it != referenceKeys.keys.end())
+        return it->second;
+    const auto key = ReferenceKey(referenceKeys.names.size());
+    referenceKeys.names.emplace_back(keyC);
+    referenceKeys.keys.insert({referenceKeys.names.back(), key});
+    return key;
+}
+
+static std::string referenceKeyName(ReferenceKey key)
+{
+    auto &referenceKeys = Object::referenceKeys();
+    std::lock_guard<std::mutex> locker(referenceKeys.mutex);
+    return key >= 0 && std::size_t(key) < referenceKeys.names.size()
+        ? referenceKeys.names[key] : std::string{};
+}
+
+static void removeRefCountKey(SbkObject *self, ReferenceKey key)
 {
     if (self->d->referredObjects) {
-        const auto iterPair = self->d->referredObjects->equal_range(key);
-        if (iterPair.first != iterPair.second) {
-            decRefPyObjectList(iterPair.first, iterPair.second);
-            self->d->referredObjects->erase(iterPair.first, iterPair.second);
+        // Remove the entries before releasing the objects since that
+        // can run arbitrary code.
+        RefCountMap &refCountMap = *(self->d->referredObjects);
+        auto end = std::stable_partition(refCountMap.begin(), refCountMap.end(),
+                                         [key](const RefCountMap::value_type &v) {
+                                             return v.first != key;
+                                         });
+        if (end != refCountMap.end()) {
+            const RefCountMap removed(end, refCountMap.end());
+            refCountMap.erase(end, refCountMap.end());
+            for (const auto &p : removed)
+                Py_DECREF(p.second);
         }
     }
 }
 
 void keepReference(SbkObject *self, const char *keyC, PyObject *referredObject, bool append)
 {
-    std::string key(keyC);
+    keepReference(self, referenceKey(keyC), referredObject, append);
+}
 
+void keepReference(SbkObject *self, ReferenceKey key, PyObject *referredObject, bool append)
+{
+    CriticalSection section(reinterpret_cast<PyObject *>(self));
     if (isNone(referredObject)) {
         removeRefCountKey(self, key);
         return;
     }
 
-    if (!self->d->referredObjects) {
-        self->d->referredObjects =
-            new Shiboken::RefCountMap{RefCountMap::value_type{key, referredObject}};
-        Py_INCREF(referredObject);
-        return;
-    }
+    if (!self->d->referredObjects)
+        self->d->referredObjects = new Shiboken::RefCountMap;
 
     RefCountMap &refCountMap = *(self->d->referredObjects);
-    const auto iterPair = refCountMap.equal_range(key);
-    if (std::any_of(iterPair.first, iterPair.second,
-                    [referredObject](const RefCountMap::value_type &v) { return v.second == referredObject; })) {
-        return;
-    }
-
-    if (!append && iterPair.first != iterPair.second) {
-        decRefPyObjectList(iterPair.first, iterPair.second);
-        refCountMap.erase(iterPair.first, iterPair.second);
+    bool hasKey = false;
+    for (const auto &p : refCountMap) {
+        if (p.first == key) {
+            if (p.second == referredObject)
+                return;
+            hasKey = true;
+        }
     }
 
-    refCountMap.insert(RefCountMap::value_type{key, referredObject});
     Py_INCREF(referredObject);
+    if (!append && hasKey)
+        removeRefCountKey(self, key);
+    self->d->referredObjects->push_back({key, referredObject});
 }
 
 void removeReference(SbkObject *self, const char *key, PyObject *referredObject)
 {
-    if (!isNone(referredObject))
-        removeRefCountKey(self, std::string(key));
+    removeReference(self, referenceKey(key), referredObject);
+}
+
+void removeReference(SbkObject *self, ReferenceKey key, PyObject *referredObject)
+{
+    if (!isNone(referredObject)) {
+        CriticalSection section(reinterpret_cast<PyObject *>(self));
+        removeRefCountKey(self, key);
+    }
 }
 
 void clearReferences(SbkObject *self)
 {
+    CriticalSection section(reinterpret_cast<PyObject *>(self));
     if (!self->d->referredObjects)
         return;
 
@@ -1892,7 +2215,7 @@ std::string info(SbkObject *self)
          "validCppObject.... " << self->d->validCppObject << "\n"
          "wasCreatedByPython " << self->d->cppObjectCreated << "\n"
          "value......        " << isValueType(self) << "\n"
-         "reference count... " << reinterpret_cast<PyObject *>(self)->ob_refcnt << '\n';
+         "reference count... " << Py_REFCNT(reinterpret_cast<PyObject *>(self)) << '\n';
 
     if (self->d->parentInfo && self->d->parentInfo->parent) {
         s << "parent............ ";
@@ -1910,14 +2233,19 @@ std::string info(SbkObject *self)
     }
 
     if (self->d->referredObjects && !self->d->referredObjects->empty()) {
-        const Shiboken::RefCountMap &map = *self->d->referredObjects;
+        // Group the entries by key, which are not necessarily contiguous
+        Shiboken::RefCountMap map = *self->d->referredObjects;
+        std::stable_sort(map.begin(), map.end(),
+                         [](const RefCountMap::value_type &p1, const RefCountMap::value_type &p2) {
+                             return p1.first < p2.first;
+                         });
         s << "referred objects.. ";
-        std::string lastKey;
+        ReferenceKey lastKey = -1;
         for (const auto &p : map) {
             if (p.first != lastKey) {
-                if (!lastKey.empty())
+                if (lastKey != -1)
                     s << "                   ";
-                s << '"' << p.first << "\" => ";
+                s << '"' << referenceKeyName(p.first) << "\" => ";
                 lastKey = p.first;
             }
             Shiboken::AutoDecRef obj(PyObject_Str(p.second));
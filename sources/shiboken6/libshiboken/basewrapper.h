@@ -161,6 +161,23 @@ LIBSHIBOKEN_API PyObject *checkInvalidArgumentCount(Py_ssize_t numArgs,
                                                     Py_ssize_t minArgs,
                                                     Py_ssize_t maxArgs);
 
+/// Helpers for wrappers using the METH_FASTCALL calling convention
+/// (generator option --use-fastcall).
+/// Copy the positional arguments into \p pyArgs (borrowed references)
+/// after checking their count like PyArg_UnpackTuple() does.
+LIBSHIBOKEN_API bool unpackFastCallArguments(PyObject *const *args, Py_ssize_t nargs,
+                                             const char *funcName,
+                                             Py_ssize_t minArgs, Py_ssize_t maxArgs,
+                                             PyObject **pyArgs);
+
+/// Create a tuple from the positional arguments for error reporting.
+LIBSHIBOKEN_API PyObject *fastCallArgumentsToTuple(PyObject *const *args, Py_ssize_t nargs);
+
+/// Create a keyword dictionary from the keyword names and the values following
+/// the positional arguments. Returns nullptr if there are no keywords or
+/// with an error set on failure.
+LIBSHIBOKEN_API PyObject *fastCallKeywordsToDict(PyObject *const *kwValues, PyObject *kwNames);
+
 namespace ObjectType {
 
 /**
@@ -470,6 +487,27 @@ LIBSHIBOKEN_API void invalidate(SbkObject *self);
  **/
 LIBSHIBOKEN_API void invalidate(PyObject *pyobj);
 
+/// Flags for releaseChildren()
+enum ReleaseChildrenFlags
+{
+    /// Invalidate the wrappers
+    InvalidateChildren = 0x1,
+    /// Invalidate the wrappers which are referenced elsewhere (reference count > 1)
+    InvalidateReferencedChildren = 0x2
+};
+
+/**
+ *  Remove the wrappers of a list of C++ objects from their parents, for example
+ *  before a container deletes its items. Objects without wrapper are skipped.
+ *  Equivalent to calling invalidate() (depending on \p flags) and removeParent()
+ *  for each wrapper, but cheaper for large numbers of objects.
+ *  \param cppObjects the C++ objects
+ *  \param count number of objects
+ *  \param flags a combination of ReleaseChildrenFlags
+ */
+LIBSHIBOKEN_API void releaseChildren(const void *const *cppObjects, std::size_t count,
+                                     unsigned flags = 0);
+
 /**
  * Make the object valid again
  */
@@ -506,6 +544,21 @@ LIBSHIBOKEN_API void *getTypeUserData(SbkObject *wrapper);
  */
 LIBSHIBOKEN_API void keepReference(SbkObject *self, const char *key, PyObject *referredObject, bool append = false);
 
+/// Interned key of keepReference()/removeReference()
+using ReferenceKey = int;
+
+/**
+ *   Returns the interned key for a key string of keepReference().
+ *   Generated code stores it in a static variable to avoid looking up
+ *   the string for each call.
+ */
+LIBSHIBOKEN_API ReferenceKey referenceKey(const char *key);
+
+/**
+ *   Overload of keepReference() taking an interned key.
+ */
+LIBSHIBOKEN_API void keepReference(SbkObject *self, ReferenceKey key, PyObject *referredObject, bool append = false);
+
 /**
  *   Removes any reference previously added by keepReference function
  *   \param self            the wrapper instance that keeps references to other objects.
@@ -514,6 +567,11 @@ LIBSHIBOKEN_API void keepReference(SbkObject *self, const char *key, PyObject *r
  */
 LIBSHIBOKEN_API void removeReference(SbkObject *self, const char *key, PyObject *referredObject);
 
+/**
+ *   Overload of removeReference() taking an interned key.
+ */
+LIBSHIBOKEN_API void removeReference(SbkObject *self, ReferenceKey key, PyObject *referredObject);
+
 } // namespace Object
 
 } // namespace Shiboken
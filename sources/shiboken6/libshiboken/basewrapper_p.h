@@ -7,9 +7,14 @@
 #include "sbkpython.h"
 #include "basewrapper.h"
 
+#include <algorithm>
+#ifdef Py_GIL_DISABLED
+#  include <atomic>
+#endif
 #include <unordered_map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 #include <iosfwd>
 
@@ -21,19 +26,28 @@ namespace Shiboken
 /**
     * This mapping associates a method and argument of an wrapper object with the wrapper of
     * said argument when it needs the binding to help manage its reference count.
+    * It is a list of pairs of interned key (Object::referenceKey()) and object since
+    * wrappers usually keep few references.
     */
-using RefCountMap = std::unordered_multimap<std::string, PyObject *> ;
+using RefCountMap = std::vector<std::pair<Object::ReferenceKey, PyObject *>>;
 
-/// Linked list of SbkBaseWrapper pointers
-using ChildrenList = std::set<SbkObject *>;
+/// List of SbkBaseWrapper pointers. The order is not significant, children
+/// are removed by moving the last element into their position.
+using ChildrenList = std::vector<SbkObject *>;
 
 /// Structure used to store information about object parent and children.
 struct ParentInfo
 {
+    /// Allocated from a pool (see basewrapper.cpp).
+    LIBSHIBOKEN_API static void *operator new(std::size_t size);
+    LIBSHIBOKEN_API static void operator delete(void *p) noexcept;
+
     /// Pointer to parent object.
     SbkObject *parent = nullptr;
     /// List of object children.
     ChildrenList children;
+    /// Position in the children list of the parent.
+    std::size_t indexInParent = 0;
     /// has internal ref
     bool hasWrapperRef = false;
 };
@@ -55,8 +69,38 @@ struct SbkObjectPrivate
     SbkObjectPrivate &operator=(const SbkObjectPrivate &) = delete;
     SbkObjectPrivate &operator=(SbkObjectPrivate &&o) = delete;
 
+    /// Allocated from a pool (see basewrapper.cpp).
+    LIBSHIBOKEN_API static void *operator new(std::size_t size);
+    LIBSHIBOKEN_API static void operator delete(void *p) noexcept;
+
+    /// Allocates the array of C++ pointers, which is stored inline for
+    /// types without multiple inheritance.
+    void allocateCppPointers(int count)
+    {
+        cptr = count == 1 ? &singleCptr : new void *[count];
+        std::fill(cptr, cptr + count, nullptr);
+    }
+
+    void releaseCppPointers()
+    {
+        if (cptr != &singleCptr)
+            delete [] cptr;
+        cptr = nullptr;
+    }
+
     /// Pointer to the C++ class.
     void ** cptr;
+    /// Storage of cptr for single inheritance.
+    void *singleCptr;
+#ifdef Py_GIL_DISABLED
+    // The flags below as separate atomics; updates of bit fields sharing a
+    // word from different threads would be lost without the GIL.
+    std::atomic<bool> hasOwnership;
+    std::atomic<bool> containsCppWrapper;
+    std::atomic<bool> validCppObject;
+    std::atomic<bool> cppObjectCreated;
+    std::atomic<bool> isQAppSingleton;
+#else
     /// True when Python is responsible for freeing the used memory.
     unsigned int hasOwnership : 1;
     /// This is true when the C++ class of the wrapped object has a virtual destructor AND was created by Python.
@@ -68,6 +112,7 @@ struct SbkObjectPrivate
     /// PYSIDE-1470: Marked as true if this is the Q*Application singleton.
     /// This bit allows app deletion from shiboken?.delete() .
     unsigned int isQAppSingleton : 1;
+#endif
     /// Information about the object parents and children, may be null.
     Shiboken::ParentInfo *parentInfo;
     /// Manage reference count of objects that are referred to but not owned from.
@@ -75,6 +120,7 @@ struct SbkObjectPrivate
 
     ~SbkObjectPrivate()
     {
+        releaseCppPointers();
         delete parentInfo;
         parentInfo = nullptr;
         delete referredObjects;
@@ -10,10 +10,14 @@
 #include "sbkmodule.h"
 #include "sbkstring.h"
 #include "sbkstaticstrings.h"
+#include "sbkstaticstrings_p.h"
 #include "sbkfeature_base.h"
 #include "debugfreehook.h"
+#include "sbkmutex.h"
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <iostream>
@@ -50,6 +54,72 @@ namespace Shiboken
 
 using WrapperMap = std::unordered_map<const void *, SbkObject *>;
 
+// The wrapper map is split into shards selected by a hash of the C++ pointer,
+// each guarded by its own lock. retrieveWrapper() is called for each virtual
+// override dispatch and from QML threads without GIL; a single lock is heavily
+// contended in that case. std::shared_mutex was rejected since it is slower
+// than std::mutex for critical sections as short as a hash lookup.
+class ShardedWrapperMap
+{
+public:
+    static constexpr std::size_t shardCount = 64;
+
+    // Aligned to avoid false sharing of the locks between cores
+    struct alignas(64) Shard
+    {
+        WrapperMap map;
+        std::mutex lock;
+    };
+
+    Shard &shard(const void *cptr) { return m_shards[shardIndex(cptr)]; }
+    Shard &shardAt(std::size_t i) { return m_shards[i]; }
+    const Shard &shardAt(std::size_t i) const { return m_shards[i]; }
+
+    SbkObject *find(const void *cptr);
+    std::size_t size() const;
+    WrapperMap snapshot();
+
+private:
+    static std::size_t shardIndex(const void *cptr)
+    {
+        // Skip the low bits which are zero due to allocation alignment and
+        // fold in higher bits so that objects allocated at strides of a
+        // multiple of the shard count do not end up in the same shard.
+        auto h = reinterpret_cast<std::uintptr_t>(cptr) >> 4;
+        h ^= (h >> 7) ^ (h >> 13);
+        return h % shardCount;
+    }
+
+    std::array<Shard, shardCount> m_shards;
+};
+
+SbkObject *ShardedWrapperMap::find(const void *cptr)
+{
+    auto &s = shard(cptr);
+    std::lock_guard<std::mutex> guard(s.lock);
+    auto iter = s.map.find(cptr);
+    return iter != s.map.end() ? iter->second : nullptr;
+}
+
+// Not locking; for debug output only
+std::size_t ShardedWrapperMap::size() const
+{
+    std::size_t result = 0;
+    for (const auto &s : m_shards)
+        result += s.map.size();
+    return result;
+}
+
+WrapperMap ShardedWrapperMap::snapshot()
+{
+    WrapperMap result;
+    for (auto &s : m_shards) {
+        std::lock_guard<std::mutex> guard(s.lock);
+        result.insert(s.map.cbegin(), s.map.cend());
+    }
+    return result;
+}
+
 template <class NodeType>
 class BaseGraph
 {
@@ -163,17 +233,48 @@ bool Graph::dumpTypeGraph(const char *fileName) const
     return true;
 }
 
+// Key for caching virtual methods not overridden in Python: The type,
+// the (snake case) name and the feature selection flag.
+struct OverrideCacheKey
+{
+    PyTypeObject *type;
+    PyObject *name;
+    int flag;
+
+    friend bool operator==(const OverrideCacheKey &k1, const OverrideCacheKey &k2)
+    {
+        return k1.type == k2.type && k1.name == k2.name && k1.flag == k2.flag;
+    }
+};
+
+struct OverrideCacheKeyHash
+{
+    size_t operator()(const OverrideCacheKey &k) const noexcept
+    {
+        const size_t h = std::hash<const void *>{}(k.type);
+        return h ^ (std::hash<const void *>{}(k.name) + 0x9e3779b9 + (h << 6) + (h >> 2)
+                    + size_t(k.flag));
+    }
+};
+
+using OverrideCache = std::unordered_set<OverrideCacheKey, OverrideCacheKeyHash>;
+
 struct BindingManager::BindingManagerPrivate {
     using DestructorEntries = std::vector<DestructorEntry>;
 
-    WrapperMap wrapperMapper;
-    // Guard wrapperMapper mainly for QML which calls into the generated
+    // Guarded (per shard) mainly for QML which calls into the generated
     // QObject::metaObject() and elsewhere from threads without GIL, causing
-    // crashes for example in retrieveWrapper(). std::shared_mutex was rejected due to:
-    // https://stackoverflow.com/questions/50972345/when-is-stdshared-timed-mutex-slower-than-stdmutex-and-when-not-to-use-it
-    std::recursive_mutex wrapperMapLock;
+    // crashes for example in retrieveWrapper().
+    ShardedWrapperMap wrapperMapper;
     Graph classHierarchy;
     DestructorEntries deleteInMainThread;
+    // Virtual methods not overridden in Python, checked by getOverride().
+    // The generation is incremented when the cache is cleared so that
+    // lookups running concurrently do not insert outdated entries. Both are
+    // guarded by the mutex on free-threaded builds.
+    OverrideCache nonOverriddenMethods;
+    unsigned overrideCacheGeneration = 0;
+    Mutex overrideCacheMutex;
 
     bool releaseWrapper(void *cptr, SbkObject *wrapper, const int *bases = nullptr);
     bool releaseWrapperHelper(void *cptr, SbkObject *wrapper);
@@ -187,9 +288,11 @@ inline bool BindingManager::BindingManagerPrivate::releaseWrapperHelper(void *cp
     // The wrapper argument is checked to ensure that the correct wrapper is released.
     // Returns true if the correct wrapper is found and released.
     // If wrapper argument is NULL, no such check is performed.
-    auto iter = wrapperMapper.find(cptr);
-    if (iter != wrapperMapper.end() && (wrapper == nullptr || iter->second == wrapper)) {
-        wrapperMapper.erase(iter);
+    auto &shard = wrapperMapper.shard(cptr);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    auto iter = shard.map.find(cptr);
+    if (iter != shard.map.end() && (wrapper == nullptr || iter->second == wrapper)) {
+        shard.map.erase(iter);
         return true;
     }
     return false;
@@ -199,7 +302,6 @@ bool BindingManager::BindingManagerPrivate::releaseWrapper(void *cptr, SbkObject
                                                            const int *bases)
 {
     assert(cptr);
-    std::lock_guard<std::recursive_mutex> guard(wrapperMapLock);
     const bool result = releaseWrapperHelper(cptr, wrapper);
     if (bases != nullptr) {
         auto *base = static_cast<uint8_t *>(cptr);
@@ -212,16 +314,15 @@ bool BindingManager::BindingManagerPrivate::releaseWrapper(void *cptr, SbkObject
 inline void BindingManager::BindingManagerPrivate::assignWrapperHelper(SbkObject *wrapper,
                                                                        const void *cptr)
 {
-    auto iter = wrapperMapper.find(cptr);
-    if (iter == wrapperMapper.end())
-        wrapperMapper.insert(std::make_pair(cptr, wrapper));
+    auto &shard = wrapperMapper.shard(cptr);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    shard.map.insert(std::make_pair(cptr, wrapper)); // Does not overwrite existing entries
 }
 
 void BindingManager::BindingManagerPrivate::assignWrapper(SbkObject *wrapper, const void *cptr,
                                                           const int *bases)
 {
     assert(cptr);
-    std::lock_guard<std::recursive_mutex> guard(wrapperMapLock);
     assignWrapperHelper(wrapper, cptr);
     if (bases != nullptr) {
         const auto *base = static_cast<const uint8_t *>(cptr);
@@ -251,11 +352,19 @@ BindingManager::~BindingManager()
      * the BindingManager is being destroyed the interpreter is alredy
      * shutting down. */
     if (Py_IsInitialized()) {  // ensure the interpreter is still valid
-        std::lock_guard<std::recursive_mutex> guard(m_d->wrapperMapLock);
-        while (!m_d->wrapperMapper.empty()) {
-            Object::destroy(m_d->wrapperMapper.begin()->second, const_cast<void *>(m_d->wrapperMapper.begin()->first));
+        for (std::size_t i = 0; i < ShardedWrapperMap::shardCount; ++i) {
+            auto &shard = m_d->wrapperMapper.shardAt(i);
+            while (true) {
+                // Object::destroy() releases the wrapper, do not hold the lock.
+                std::unique_lock<std::mutex> guard(shard.lock);
+                if (shard.map.empty())
+                    break;
+                auto front = *shard.map.cbegin();
+                guard.unlock();
+                Object::destroy(front.second, const_cast<void *>(front.first));
+            }
         }
-        assert(m_d->wrapperMapper.empty());
+        assert(m_d->wrapperMapper.size() == 0);
     }
     delete m_d;
 }
@@ -267,8 +376,7 @@ BindingManager &BindingManager::instance() {
 
 bool BindingManager::hasWrapper(const void *cptr)
 {
-    std::lock_guard<std::recursive_mutex> guard(m_d->wrapperMapLock);
-    return m_d->wrapperMapper.find(cptr) != m_d->wrapperMapper.end();
+    return m_d->wrapperMapper.find(cptr) != nullptr;
 }
 
 void BindingManager::registerWrapper(SbkObject *pyObj, void *cptr)
@@ -313,11 +421,31 @@ void BindingManager::addToDeletionInMainThread(const DestructorEntry &e)
 
 SbkObject *BindingManager::retrieveWrapper(const void *cptr)
 {
-    std::lock_guard<std::recursive_mutex> guard(m_d->wrapperMapLock);
-    auto iter = m_d->wrapperMapper.find(cptr);
-    if (iter == m_d->wrapperMapper.end())
-        return nullptr;
-    return iter->second;
+    return m_d->wrapperMapper.find(cptr);
+}
+
+// Check whether the result of getOverride() for a type can be cached. This is
+// the case when all types of the MRO are wrapper types, whose attribute changes
+// invalidate the cache (see SbkObjectType_tp_setattro()), and there is no custom
+// attribute lookup in Python.
+static bool isOverrideCacheable(PyTypeObject *type)
+{
+    PyObject *mro = type->tp_mro;
+    const Py_ssize_t size = PyTuple_Size(mro);
+    // The last class in the mro (size - 1) is the base Python object class.
+    for (Py_ssize_t idx = 0; idx < size - 1; ++idx) {
+        auto *t = reinterpret_cast<PyTypeObject *>(PyTuple_GetItem(mro, idx));
+        if (!SbkObjectType_Check(t))
+            return false;
+        if (ObjectType::isUserType(t)) {
+            AutoDecRef tpDict(PepType_GetDict(t));
+            if (PyDict_GetItem(tpDict.object(), PyMagicName::getattr()) != nullptr
+                || PyDict_GetItem(tpDict.object(), PyMagicName::getattribute()) != nullptr) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
 PyObject *BindingManager::getOverride(const void *cptr,
@@ -353,6 +481,15 @@ PyObject *BindingManager::getOverride(const void *cptr,
         return method;
     }
 
+    const OverrideCacheKey cacheKey{Py_TYPE(wrapper), pyMethodName, flag};
+    unsigned cacheGeneration{};
+    {
+        std::lock_guard<Mutex> locker(m_d->overrideCacheMutex);
+        if (m_d->nonOverriddenMethods.find(cacheKey) != m_d->nonOverriddenMethods.end())
+            return nullptr;
+        cacheGeneration = m_d->overrideCacheGeneration;
+    }
+
     PyObject *method = PyObject_GetAttr(obWrapper, pyMethodName);
 
     PyObject *function = nullptr;
@@ -413,9 +550,21 @@ PyObject *BindingManager::getOverride(const void *cptr,
         Py_DECREF(method);
     }
 
+    if (PyErr_Occurred() == nullptr && isOverrideCacheable(Py_TYPE(wrapper))) {
+        std::lock_guard<Mutex> locker(m_d->overrideCacheMutex);
+        if (cacheGeneration == m_d->overrideCacheGeneration)
+            m_d->nonOverriddenMethods.insert(cacheKey);
+    }
     return nullptr;
 }
 
+void BindingManager::clearOverrideCache()
+{
+    std::lock_guard<Mutex> locker(m_d->overrideCacheMutex);
+    m_d->nonOverriddenMethods.clear();
+    ++m_d->overrideCacheGeneration;
+}
+
 void BindingManager::addClassInheritance(Module::TypeInitStruct *parent,
                                          Module::TypeInitStruct *child)
 {
@@ -439,18 +588,19 @@ PyTypeObject *BindingManager::resolveType(void **cptr, PyTypeObject *type)
 std::set<PyObject *> BindingManager::getAllPyObjects()
 {
     std::set<PyObject *> pyObjects;
-    std::lock_guard<std::recursive_mutex> guard(m_d->wrapperMapLock);
-    const WrapperMap &wrappersMap = m_d->wrapperMapper;
-    auto it = wrappersMap.begin();
-    for (; it != wrappersMap.end(); ++it)
-        pyObjects.insert(reinterpret_cast<PyObject *>(it->second));
+    for (std::size_t i = 0; i < ShardedWrapperMap::shardCount; ++i) {
+        auto &shard = m_d->wrapperMapper.shardAt(i);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        for (const auto &p : shard.map)
+            pyObjects.insert(reinterpret_cast<PyObject *>(p.second));
+    }
 
     return pyObjects;
 }
 
 void BindingManager::visitAllPyObjects(ObjectVisitor visitor, void *data)
 {
-    WrapperMap copy = m_d->wrapperMapper;
+    const WrapperMap copy = m_d->wrapperMapper.snapshot();
     for (const auto &p : copy) {
         if (hasWrapper(p.first))
             visitor(p.second, data);
@@ -464,7 +614,7 @@ bool BindingManager::dumpTypeGraph(const char *fileName) const
 
 void BindingManager::dumpWrapperMap()
 {
-    const auto &wrapperMap = m_d->wrapperMapper;
+    const WrapperMap wrapperMap = m_d->wrapperMapper.snapshot();
     std::cerr <<  "-------------------------------\n"
         << "WrapperMap size: " << wrapperMap.size() << " Types: "
         << m_d->classHierarchy.nodeSet().size() << '\n';
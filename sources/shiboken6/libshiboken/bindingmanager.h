@@ -43,6 +43,9 @@ public:
 
     SbkObject *retrieveWrapper(const void *cptr);
     PyObject *getOverride(const void *cptr, PyObject *nameCache[], const char *methodName);
+    /// Clear the cache of methods found not to be overridden by getOverride().
+    /// Called when attributes of wrapper types change.
+    void clearOverrideCache();
 
     void addClassInheritance(Module::TypeInitStruct *parent, Module::TypeInitStruct *child);
     /// Try to find the correct type of cptr via type discovery knowing that it's at least
@@ -10,10 +10,12 @@
 #include "basewrapper.h"
 #include "basewrapper_p.h"
 #include "sbkenum.h"
+#include "sbkmutex.h"
 #include "voidptr.h"
 
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 
 extern "C"
 {
@@ -1118,6 +1120,7 @@ void PepType_SOTP_delete(PyTypeObject *type)
  */
 static std::unordered_map<SbkEnumType *, SbkEnumTypePrivate> SETP_extender{};
 static thread_local SbkEnumType *SETP_key{};
+static Shiboken::Mutex SETP_mutex;
 static thread_local SbkEnumTypePrivate *SETP_value{};
 
 SbkEnumTypePrivate *PepType_SETP(SbkEnumType *enumType)
@@ -1125,6 +1128,7 @@ SbkEnumTypePrivate *PepType_SETP(SbkEnumType *enumType)
     // PYSIDE-2230: This makes no sense at all for Enum types.
     if (enumType == SETP_key)
         return SETP_value;
+    std::lock_guard<Shiboken::Mutex> locker(SETP_mutex);
     auto it = SETP_extender.find(enumType);
     if (it == SETP_extender.end())
         it = SETP_extender.insert({enumType, SbkEnumTypePrivate{nullptr, nullptr}}).first;
@@ -1135,6 +1139,7 @@ SbkEnumTypePrivate *PepType_SETP(SbkEnumType *enumType)
 
 void PepType_SETP_delete(SbkEnumType *enumType)
 {
+    std::lock_guard<Shiboken::Mutex> locker(SETP_mutex);
     SETP_extender.erase(enumType);
     SETP_key = nullptr;
 }
@@ -324,6 +324,12 @@ using PyCFunctionObject = struct _pycfunc;
 #define PepCFunction_GET_NAMESTR(func)        ((func)->m_ml->ml_name)
 #endif
 
+// METH_FASTCALL is part of the stable ABI since Python 3.10, but the flag
+// value is understood by all supported interpreters (since Python 3.7).
+#ifndef METH_FASTCALL
+#  define METH_FASTCALL  0x0080
+#endif
+
 /*****************************************************************************
  *
  * RESOLVED: pythonrun.h
@@ -3,6 +3,8 @@
 
 #include "sbkconverter.h"
 #include "sbkconverter_p.h"
+#include "sbkmutex.h"
+#include "sbkoverloadcache.h"
 #include "sbkarrayconverter_p.h"
 #include "sbkmodule.h"
 #include "basewrapper_p.h"
@@ -13,9 +15,12 @@
 
 #include <string>
 #include <cstring>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <map>
 #include <set>
 
@@ -24,6 +29,25 @@ static SbkConverter **PrimitiveTypeConverters;
 using ConvertersMap = std::unordered_map<std::string, SbkConverter *>;
 static ConvertersMap converters;
 
+// Type names interned by converterId(). The index into the vector is the id;
+// the converter is filled in when a name is registered or lazily resolved.
+struct ConverterIdEntry
+{
+    std::string typeName;
+    SbkConverter *converter = nullptr;
+    // Value of negativeCacheGeneration when a lookup failed, 0 if not tried.
+    unsigned failedGeneration = 0;
+};
+
+static std::unordered_map<std::string, int> converterIds;
+// A deque keeps the type names returned by converterIdTypeName() in place.
+static std::deque<ConverterIdEntry> convertersById;
+static unsigned negativeCacheGeneration = 1;
+
+// Protects the above registries on free-threaded builds. It is never held
+// while calling into Python (loading lazy classes registers converters).
+static Shiboken::Mutex convertersMutex;
+
 namespace Shiboken::Conversions {
 
 void initArrayConverters();
@@ -217,6 +241,7 @@ SbkConverter *createConverter(PyTypeObject *type, CppToPythonFunc toPythonFunc)
 void deleteConverter(SbkConverter *converter)
 {
     if (converter) {
+        OverloadCache::invalidate();
         converter->toCppConversions.clear();
         delete converter;
     }
@@ -231,6 +256,7 @@ void setPythonToCppPointerFunctions(SbkConverter *converter,
                                     PythonToCppFunc toCppPointerConvFunc,
                                     IsConvertibleToCppFunc toCppPointerCheckFunc)
 {
+    OverloadCache::invalidate();
     converter->toCppPointerConversion = std::make_pair(toCppPointerCheckFunc, toCppPointerConvFunc);
 }
 
@@ -238,6 +264,7 @@ void addPythonToCppValueConversion(SbkConverter *converter,
                                    PythonToCppFunc pythonToCppFunc,
                                    IsConvertibleToCppFunc isConvertibleToCppFunc)
 {
+    OverloadCache::invalidate();
     converter->toCppConversions.push_back(std::make_pair(isConvertibleToCppFunc, pythonToCppFunc));
 }
 
@@ -245,6 +272,7 @@ void prependPythonToCppValueConversion(SbkConverter *converter,
                                        PythonToCppFunc pythonToCppFunc,
                                        IsConvertibleToCppFunc isConvertibleToCppFunc)
 {
+    OverloadCache::invalidate();
     converter->toCppConversions.insert(converter->toCppConversions.begin(),
                                        std::make_pair(isConvertibleToCppFunc, pythonToCppFunc));
 }
@@ -525,20 +553,33 @@ bool isImplicitConversion(PyTypeObject *type, PythonToCppFunc toCppFunc)
     return toCppFunc != (*conv).second;
 }
 
+// Keep an interned type name in sync with the name registry.
+static void updateConverterId(const std::string &typeName, SbkConverter *converter)
+{
+    auto it = converterIds.find(typeName);
+    if (it != converterIds.end())
+        convertersById[it->second].converter = converter;
+}
+
 void registerConverterName(SbkConverter *converter, const char *typeName)
 {
+    std::lock_guard<Shiboken::Mutex> locker(convertersMutex);
     auto iter = converters.find(typeName);
     if (iter == converters.end())
         converters.insert(std::make_pair(typeName, converter));
     else
         iter->second = converter;
+    updateConverterId(typeName, converter);
 }
 
 void registerConverterAlias(SbkConverter *converter, const char *typeName)
 {
+    std::lock_guard<Shiboken::Mutex> locker(convertersMutex);
     auto iter = converters.find(typeName);
-    if (iter == converters.end())
+    if (iter == converters.end()) {
         converters.insert(std::make_pair(typeName, converter));
+        updateConverterId(typeName, converter);
+    }
 }
 
 static std::string getRealTypeName(const std::string &typeName)
@@ -558,10 +599,21 @@ static std::unordered_set<std::string> nonExistingTypeNames{};
 // Arbitrary size limit to prevent random name overflows.
 static constexpr std::size_t negativeCacheLimit = 50;
 
+static void clearNegativeLazyCacheHelper()
+{
+    for (const auto &typeName : nonExistingTypeNames) {
+        auto it = converters.find(typeName);
+        converters.erase(it);
+    }
+    nonExistingTypeNames.clear();
+    // Failed id lookups need to be retried.
+    ++negativeCacheGeneration;
+}
+
 static void rememberAsNonexistent(const std::string &typeName)
 {
     if (nonExistingTypeNames.size() > negativeCacheLimit)
-        clearNegativeLazyCache();
+        clearNegativeLazyCacheHelper();
     converters.insert(std::make_pair(typeName, nullptr));
     nonExistingTypeNames.insert(typeName);
 }
@@ -569,18 +621,24 @@ static void rememberAsNonexistent(const std::string &typeName)
 SbkConverter *getConverter(const char *typeNameC)
 {
     std::string typeName = typeNameC;
-    auto it = converters.find(typeName);
-    // PYSIDE-2404: This can also contain explicit nullptr as a negative cache.
-    if (it != converters.end())
-        return it->second;
+    {
+        std::lock_guard<Shiboken::Mutex> locker(convertersMutex);
+        auto it = converters.find(typeName);
+        // PYSIDE-2404: This can also contain explicit nullptr as a negative cache.
+        if (it != converters.end())
+            return it->second;
+    }
     // PYSIDE-2404: Did not find the name. Load the lazy classes
     //              which have this name and try again.
     Shiboken::Module::loadLazyClassesWithName(getRealTypeName(typeName).c_str());
-    it = converters.find(typeName);
-    if (it != converters.end())
-        return it->second;
-    // Cache the negative result. Don't forget to clear the cache for new modules.
-    rememberAsNonexistent(typeName);
+    {
+        std::lock_guard<Shiboken::Mutex> locker(convertersMutex);
+        auto it = converters.find(typeName);
+        if (it != converters.end())
+            return it->second;
+        // Cache the negative result. Don't forget to clear the cache for new modules.
+        rememberAsNonexistent(typeName);
+    }
 
     if (Shiboken::pyVerbose() > 0) {
         const std::string message =
@@ -592,11 +650,54 @@ SbkConverter *getConverter(const char *typeNameC)
 
 void clearNegativeLazyCache()
 {
-    for (const auto &typeName : nonExistingTypeNames) {
-        auto it = converters.find(typeName);
-        converters.erase(it);
-    }
-    nonExistingTypeNames.clear();
+    std::lock_guard<Shiboken::Mutex> locker(convertersMutex);
+    clearNegativeLazyCacheHelper();
+}
+
+int converterId(const char *typeNameC)
+{
+    std::string typeName = typeNameC;
+    std::lock_guard<Shiboken::Mutex> locker(convertersMutex);
+    auto it = converterIds.find(typeName);
+    if (it != converterIds.end())
+        return it->second;
+    const int id = int(convertersById.size());
+    ConverterIdEntry entry;
+    auto cit = converters.find(typeName);
+    if (cit != converters.end())
+        entry.converter = cit->second;
+    entry.typeName = typeName;
+    convertersById.push_back(std::move(entry));
+    converterIds.insert({typeName, id});
+    return id;
+}
+
+SbkConverter *getConverterById(int id)
+{
+    std::unique_lock<Shiboken::Mutex> locker(convertersMutex);
+    if (id < 0 || std::size_t(id) >= convertersById.size())
+        return nullptr;
+    const auto &entry = convertersById[id];
+    if (entry.converter != nullptr || entry.failedGeneration == negativeCacheGeneration)
+        return entry.converter;
+
+    // Not registered yet; this loads lazy classes of that name.
+    const char *typeName = entry.typeName.c_str();
+    locker.unlock();
+    SbkConverter *converter = getConverter(typeName);
+    locker.lock();
+    auto &resolvedEntry = convertersById[id];
+    resolvedEntry.converter = converter;
+    if (converter == nullptr)
+        resolvedEntry.failedGeneration = negativeCacheGeneration;
+    return converter;
+}
+
+const char *converterIdTypeName(int id)
+{
+    std::lock_guard<Shiboken::Mutex> locker(convertersMutex);
+    return id >= 0 && std::size_t(id) < convertersById.size()
+        ? convertersById[id].typeName.c_str() : nullptr;
 }
 
 SbkConverter *primitiveTypeConverter(int index)
@@ -875,21 +976,32 @@ bool pythonTypeIsWrapperType(const SbkConverter *converter)
     return converter->pointerToPython != nullptr;
 }
 
-SpecificConverter::SpecificConverter(const char *typeName)
-    : m_type(InvalidConversion)
+static SpecificConverter::Type specificConversionType(const SbkConverter *converter,
+                                                       const char *typeName)
 {
-    m_converter = getConverter(typeName);
-    if (!m_converter)
-        return;
+    if (converter == nullptr)
+        return SpecificConverter::InvalidConversion;
     const Py_ssize_t len = strlen(typeName);
     char lastChar = typeName[len -1];
-    if (lastChar == '&') {
-        m_type = ReferenceConversion;
-    } else if (lastChar == '*' || pythonTypeIsObjectType(m_converter)) {
-        m_type = PointerConversion;
-    } else {
-        m_type = CopyConversion;
-    }
+    if (lastChar == '&')
+        return SpecificConverter::ReferenceConversion;
+    if (lastChar == '*' || pythonTypeIsObjectType(converter))
+        return SpecificConverter::PointerConversion;
+    return SpecificConverter::CopyConversion;
+}
+
+SpecificConverter::SpecificConverter(const char *typeName)
+    : m_converter(getConverter(typeName))
+{
+    m_type = specificConversionType(m_converter, typeName);
+}
+
+SpecificConverter::SpecificConverter(int converterId)
+    : m_converter(getConverterById(converterId))
+{
+    m_type = m_converter != nullptr
+        ? specificConversionType(m_converter, converterIdTypeName(converterId))
+        : InvalidConversion;
 }
 
 PyObject *SpecificConverter::toPython(const void *cppIn)
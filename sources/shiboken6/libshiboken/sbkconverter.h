@@ -87,6 +87,8 @@ public:
     };
 
     explicit SpecificConverter(const char *typeName);
+    /// Creates a converter from an id obtained by converterId().
+    explicit SpecificConverter(int converterId);
 
     inline SbkConverter *converter() { return m_converter; }
     inline operator SbkConverter *() const { return m_converter; }
@@ -281,6 +283,18 @@ LIBSHIBOKEN_API void registerConverterAlias(SbkConverter *converter, const char
 /// Returns the converter for a given type name, or NULL if it wasn't registered before.
 LIBSHIBOKEN_API SbkConverter *getConverter(const char *typeName);
 
+/// Returns a stable integer id for a type name which can be passed to
+/// getConverterById() to look up the converter without hashing the name.
+/// Ids may be obtained before the converter is registered.
+LIBSHIBOKEN_API int converterId(const char *typeName);
+
+/// Returns the converter for an id obtained by converterId(), or NULL if
+/// no converter is registered for the type name.
+LIBSHIBOKEN_API SbkConverter *getConverterById(int id);
+
+/// Returns the type name an id was obtained for by converterId().
+LIBSHIBOKEN_API const char *converterIdTypeName(int id);
+
 /// Returns the converter for a primitive type.
 LIBSHIBOKEN_API SbkConverter *primitiveTypeConverter(int index);
 
@@ -40,6 +40,73 @@ PyObject *createIntArray1(Py_ssize_t size, const int *data)
     return _createArray1(size, NPY_INT, data);
 }
 
+static int numPyTypeFromView(View::Type t)
+{
+    switch (t) {
+    case View::Int:
+        return NPY_INT;
+    case View::Unsigned:
+        return NPY_UINT;
+    case View::Float:
+        return NPY_FLOAT;
+    case View::Double:
+        return NPY_DOUBLE;
+    case View::Int16:
+        return NPY_INT16;
+    case View::Unsigned16:
+        return NPY_UINT16;
+    case View::Int64:
+        return NPY_INT64;
+    case View::Unsigned64:
+        return NPY_UINT64;
+    case View::Int8:
+        return NPY_INT8;
+    case View::Unsigned8:
+        return NPY_UINT8;
+    case View::Bool:
+        return NPY_BOOL;
+    case View::Float16:
+        return NPY_HALF;
+    case View::ComplexFloat:
+        return NPY_CFLOAT;
+    case View::ComplexDouble:
+        return NPY_CDOUBLE;
+    }
+    return NPY_INT;
+}
+
+PyObject *createArrayView(const View &view, PyObject *owner, bool readOnly)
+{
+    if (!view) {
+        PyErr_SetString(PyExc_ValueError, "createArrayView(): Invalid view.");
+        return nullptr;
+    }
+    initNumPy();
+    if (PyArray_API == nullptr) {
+        PyErr_SetString(PyExc_ImportError, "createArrayView(): numpy could not be imported.");
+        return nullptr;
+    }
+    npy_intp dims[View::maxDimensions];
+    npy_intp strides[View::maxDimensions];
+    for (int d = 0; d < view.ndim; ++d) {
+        dims[d] = view.dimensions[d];
+        strides[d] = view.stride[d];
+    }
+    const int flags = readOnly ? NPY_ARRAY_ALIGNED : NPY_ARRAY_ALIGNED | NPY_ARRAY_WRITEABLE;
+    PyObject *result = PyArray_New(&PyArray_Type, view.ndim, dims,
+                                   numPyTypeFromView(view.type), strides,
+                                   view.data, 0, flags, nullptr);
+    if (result == nullptr)
+        return nullptr;
+    // PyArray_SetBaseObject() steals the reference
+    Py_INCREF(owner);
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject *>(result), owner) != 0) {
+        Py_DECREF(result);
+        return nullptr;
+    }
+    return result;
+}
+
 #else // HAVE_NUMPY
 
 PyObject *createByteArray1(Py_ssize_t, const uint8_t *)
@@ -62,6 +129,13 @@ PyObject *createIntArray1(Py_ssize_t, const int *)
     Py_RETURN_NONE;
 }
 
+PyObject *createArrayView(const View &, PyObject *, bool)
+{
+    PyErr_SetString(PyExc_NotImplementedError,
+                    "createArrayView(): libshiboken was built without numpy support.");
+    return nullptr;
+}
+
 #endif // !HAVE_NUMPY
 
 } //namespace Shiboken::Numpy
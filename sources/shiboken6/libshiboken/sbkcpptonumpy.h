@@ -6,6 +6,7 @@
 
 #include <sbkpython.h>
 #include <shibokenmacros.h>
+#include "sbknumpyview.h"
 
 #include <cstdint>
 
@@ -36,6 +37,18 @@ LIBSHIBOKEN_API PyObject *createFloatArray1(Py_ssize_t size, const float *data);
 /// \return PyArrayObject
 LIBSHIBOKEN_API PyObject *createIntArray1(Py_ssize_t size, const int *data);
 
+/// Create a numpy array referencing the data described by a view without
+/// copying it. The array keeps the owner alive; the data must remain valid
+/// and must not be reallocated as long as the owner exists.
+/// \param view View specifying the type, dimensions, strides and data
+/// \param owner Object owning the data (wrapper or capsule)
+/// \param readOnly Whether the array is read-only
+/// \return PyArrayObject or nullptr with an error set (ImportError if numpy
+///         cannot be imported, NotImplementedError if libshiboken was built
+///         without numpy)
+LIBSHIBOKEN_API PyObject *createArrayView(const View &view, PyObject *owner,
+                                          bool readOnly = false);
+
 } //namespace Shiboken::Numpy
 
 #endif // SBKCPPTONUMPY_H
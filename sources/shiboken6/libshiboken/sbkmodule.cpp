@@ -8,11 +8,19 @@
 #include "sbkstring.h"
 #include "sbkcppstring.h"
 #include "sbkconverter_p.h"
+#include "sbkmutex.h"
 
+#ifdef Py_GIL_DISABLED
+#  include <atomic>
+#  include <condition_variable>
+#  include <thread>
+#endif
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
+#include <cstdint>
 #include <cstring>
+#include <string_view>
 
 /// This hash maps module objects to arrays of converters.
 using ModuleConvertersMap = std::unordered_map<PyObject *, SbkConverter **> ;
@@ -29,25 +37,291 @@ struct TypeCreationStruct
 /// This hash maps type names to type creation structs.
 using NameToTypeFunctionMap = std::unordered_map<std::string, TypeCreationStruct> ;
 
-/// This hash maps module objects to maps of names to functions.
-using ModuleToFuncsMap = std::unordered_map<PyObject *, NameToTypeFunctionMap> ;
+/// The not yet created types of a module.
+struct LazyTypes
+{
+    /// Types added by AddTypeCreationFunction().
+    NameToTypeFunctionMap nameToFunc;
+    /// Types added by AddTypeCreationIndex().
+    const Shiboken::Module::TypeCreationIndex *index = nullptr;
+    std::vector<bool> created;
+};
+
+/// This hash maps module objects to their lazily created types.
+using ModuleToFuncsMap = std::unordered_map<PyObject *, LazyTypes> ;
 
 /// All types produced in imported modules are mapped here.
 static ModuleTypesMap moduleTypes;
 static ModuleConvertersMap moduleConverters;
 static ModuleToFuncsMap moduleToFuncs;
 
+// Protects the above tables on free-threaded builds. It is only held while
+// accessing them and never while calling into Python since creating a type
+// runs Python code and may import modules.
+static Shiboken::Mutex moduleTablesMutex;
+using ModuleTablesLocker = Shiboken::DetachingLocker<Shiboken::Mutex>;
+
+#ifdef Py_GIL_DISABLED
+// The creation functions of the lazy types being created with the creating
+// threads. Other threads needing such a type wait until it is finished.
+static std::unordered_map<Shiboken::Module::TypeCreationFunction, std::thread::id> typesInCreation;
+static std::condition_variable typeCreationFinished;
+// TypeInitStruct::type is set before the type is completely initialized.
+// Module::get() uses it without locking only if no creation was started or
+// in progress while reading it.
+static std::atomic<unsigned> typeCreationsInProgress{0};
+static std::atomic<unsigned> typeCreationGeneration{0};
+
+// Lock the tables for waiting on typeCreationFinished.
+static std::unique_lock<Shiboken::Mutex> lockModuleTables()
+{
+    std::unique_lock<Shiboken::Mutex> locker(moduleTablesMutex, std::try_to_lock);
+    if (!locker.owns_lock()) {
+        Py_BEGIN_ALLOW_THREADS
+        locker.lock();
+        Py_END_ALLOW_THREADS
+    }
+    return locker;
+}
+
+static void waitForTypeCreation(std::unique_lock<Shiboken::Mutex> &locker)
+{
+    Py_BEGIN_ALLOW_THREADS
+    typeCreationFinished.wait(locker);
+    Py_END_ALLOW_THREADS
+}
+
+static bool otherThreadCreatesTypes()
+{
+    const auto self = std::this_thread::get_id();
+    for (const auto &creation : typesInCreation) {
+        if (creation.second != self)
+            return true;
+    }
+    return false;
+}
+
+static std::atomic<PyTypeObject *> &atomicType(Shiboken::Module::TypeInitStruct &typeStruct)
+{
+    static_assert(sizeof(std::atomic<PyTypeObject *>) == sizeof(PyTypeObject *)
+                  && alignof(std::atomic<PyTypeObject *>) == alignof(PyTypeObject *));
+    static_assert(std::atomic<PyTypeObject *>::is_always_lock_free);
+    return *reinterpret_cast<std::atomic<PyTypeObject *> *>(&typeStruct.type);
+}
+
+// Return TypeInitStruct::type once no other thread creates types. The
+// creating thread itself gets it immediately when re-entering (from the
+// creation of nested or derived types) like on regular builds.
+static PyTypeObject *currentType(Shiboken::Module::TypeInitStruct &typeStruct)
+{
+    auto locker = lockModuleTables();
+    while (true) {
+        auto *type = atomicType(typeStruct).load();
+        if (type == nullptr || !otherThreadCreatesTypes())
+            return type;
+        waitForTypeCreation(locker);
+    }
+}
+#else
+static inline PyTypeObject *currentType(Shiboken::Module::TypeInitStruct &typeStruct)
+{
+    return typeStruct.type;
+}
+#endif
+
+// Claim of the creation of a lazy type by calling its creation function.
+// isPending() is called with the tables locked and returns whether the type
+// still needs to be created. On free-threaded builds, the claim waits while
+// another thread creates the type. The creating thread may claim it again
+// when re-entering.
+class TypeCreationClaim
+{
+public:
+    TypeCreationClaim(const TypeCreationClaim &) = delete;
+    TypeCreationClaim &operator=(const TypeCreationClaim &) = delete;
+    TypeCreationClaim(TypeCreationClaim &&) = delete;
+    TypeCreationClaim &operator=(TypeCreationClaim &&) = delete;
+
+#ifdef Py_GIL_DISABLED
+    template <class Predicate>
+    explicit TypeCreationClaim(Shiboken::Module::TypeCreationFunction func,
+                               Predicate isPending) : m_func(func)
+    {
+        auto locker = lockModuleTables();
+        const auto self = std::this_thread::get_id();
+        while (true) {
+            auto it = typesInCreation.find(func);
+            if (it != typesInCreation.end() && it->second != self) {
+                waitForTypeCreation(locker);
+                continue;
+            }
+            if (!isPending())
+                return;
+            if (it == typesInCreation.end()) {
+                typesInCreation.emplace(func, self);
+                m_owner = true;
+            }
+            m_claimed = true;
+            ++typeCreationsInProgress;
+            ++typeCreationGeneration;
+            return;
+        }
+    }
+
+    ~TypeCreationClaim()
+    {
+        if (m_claimed) {
+            ModuleTablesLocker locker(moduleTablesMutex);
+            if (m_owner) {
+                typesInCreation.erase(m_func);
+                typeCreationFinished.notify_all();
+            }
+            --typeCreationsInProgress;
+        }
+    }
+#else
+    template <class Predicate>
+    explicit TypeCreationClaim(Shiboken::Module::TypeCreationFunction, Predicate isPending)
+        : m_claimed(isPending())
+    {
+    }
+#endif
+
+    bool isClaimed() const { return m_claimed; }
+
+private:
+#ifdef Py_GIL_DISABLED
+    Shiboken::Module::TypeCreationFunction m_func;
+    bool m_owner = false;
+#endif
+    bool m_claimed = false;
+};
+
+// LazyTypes::created of the index is set by the creating threads.
+static bool isCreated(const LazyTypes &lazyTypes, int entry)
+{
+    ModuleTablesLocker locker(moduleTablesMutex);
+    return lazyTypes.created[entry];
+}
+
+static void setCreated(LazyTypes &lazyTypes, int entry)
+{
+    ModuleTablesLocker locker(moduleTablesMutex);
+    lazyTypes.created[entry] = true;
+}
+
 namespace Shiboken
 {
 namespace Module
 {
 
+// Seeded FNV-1a hash of the generated type creation index, followed by the
+// MurmurHash3 finalizer for a better distribution of the lower bits.
+// Keep in sync with the generator (cppgenerator.cpp).
+static uint32_t typeNameHash(std::string_view name, uint32_t seed)
+{
+    uint32_t h = 2166136261U ^ seed;
+    for (const char c : name) {
+        h ^= uint8_t(c);
+        h *= 16777619U;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35U;
+    h ^= h >> 16;
+    return h;
+}
+
+// Return the entry of a top-level type in the index or -1.
+static int findIndexEntry(const TypeCreationIndex &index, std::string_view name)
+{
+    if (index.slotCount == 0)
+        return -1;
+    const auto slotCount = uint32_t(index.slotCount);
+    const int displacement = index.displacements[typeNameHash(name, 0) % slotCount];
+    const uint32_t slot = displacement < 0
+        ? uint32_t(-displacement - 1) : typeNameHash(name, uint32_t(displacement)) % slotCount;
+    const int entry = index.slots[slot];
+    const auto &typeEntry = index.entries[entry];
+    return typeEntry.func != nullptr && name == typeEntry.name ? entry : -1;
+}
+
+static PyTypeObject *incarnateNestedType(PyObject *module, std::string_view names,
+                                         TypeCreationFunction initFunc);
+
+// Create a top-level type of the index with its nested types. Returns nullptr
+// without error if the type was created meanwhile.
+static PyTypeObject *incarnateIndexEntry(PyObject *module, LazyTypes &lazyTypes, int entry)
+{
+    const auto *entries = lazyTypes.index->entries;
+    const auto &typeEntry = entries[entry];
+    TypeCreationClaim claim(typeEntry.func,
+                            [&lazyTypes, entry]() { return !lazyTypes.created[entry]; });
+    if (!claim.isClaimed())
+        return nullptr;
+
+    // Nested types whose top-level type is not part of the module are
+    // entries of their own, named by their name path.
+    const std::string_view name(typeEntry.name);
+    const bool isNested = name.find('.') != std::string_view::npos;
+
+    // PYSIDE-2404: Make sure that no switching happens during type creation.
+    auto saveFeature = initSelectableFeature(nullptr);
+    PyTypeObject *type = isNested
+        ? incarnateNestedType(module, name, typeEntry.func) : typeEntry.func(module);
+    if (type != nullptr) {
+        setCreated(lazyTypes, entry);
+        for (int n = entry + 1, end = n + typeEntry.nestedCount; n < end; ++n) {
+            if (entries[n].func != nullptr && !isCreated(lazyTypes, n)) {
+                incarnateNestedType(module, entries[n].name, entries[n].func);
+                setCreated(lazyTypes, n);
+            }
+        }
+    }
+    initSelectableFeature(saveFeature);
+    if (type == nullptr || isNested)
+        return type;
+
+    auto *res = reinterpret_cast<PyObject *>(type);
+    Py_INCREF(res);
+    PyModule_AddObject(module, typeEntry.name, res);   // steals reference
+    return type;
+}
+
+// Create a not yet created top-level type from the index of a module.
+// Returns the type or nullptr if it is not in the index.
+static PyTypeObject *incarnateFromIndex(PyObject *module, std::string_view name)
+{
+    LazyTypes *lazyTypes{};
+    int entry = -1;
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        auto tableIter = moduleToFuncs.find(module);
+        if (tableIter == moduleToFuncs.end() || tableIter->second.index == nullptr)
+            return nullptr;
+        lazyTypes = &tableIter->second;
+        entry = findIndexEntry(*lazyTypes->index, name);
+        if (entry < 0 || lazyTypes->created[entry])
+            return nullptr;
+    }
+    return incarnateIndexEntry(module, *lazyTypes, entry);
+}
+
 // PYSIDE-2404: Replacing the arguments generated by cpythonTypeNameExt
 //              by a function call.
 LIBSHIBOKEN_API PyTypeObject *get(TypeInitStruct &typeStruct)
 {
-    if (typeStruct.type != nullptr)
-        return typeStruct.type;
+#ifdef Py_GIL_DISABLED
+    const unsigned generation = typeCreationGeneration.load();
+    if (typeCreationsInProgress.load() == 0) {
+        auto *type = atomicType(typeStruct).load();
+        if (type != nullptr && typeCreationGeneration.load() == generation)
+            return type;
+    }
+#endif
+    if (auto *type = currentType(typeStruct))
+        return type;
 
     static PyObject *sysModules = PyImport_GetModuleDict();
 
@@ -67,6 +341,22 @@ LIBSHIBOKEN_API PyTypeObject *get(TypeInitStruct &typeStruct)
         return nullptr;
     }
 
+    // Create the top-level type from the index, which also creates the
+    // nested types.
+    const auto topLevelName = names.substr(startPos, names.find('.', startPos) - startPos);
+    if (incarnateFromIndex(modOrType, topLevelName) == nullptr && PyErr_Occurred() != nullptr)
+        return nullptr;
+    if (auto *type = currentType(typeStruct))
+        return type;
+    // A nested type whose top-level type is not part of the module.
+    const auto namePath = names.substr(startPos);
+    if (namePath.size() != topLevelName.size()
+        && incarnateFromIndex(modOrType, namePath) == nullptr && PyErr_Occurred() != nullptr) {
+        return nullptr;
+    }
+    if (auto *type = currentType(typeStruct))
+        return type;
+
     do {
         dotPos = names.find('.', startPos);
         auto typeName = dotPos != std::string::npos
@@ -75,13 +365,13 @@ LIBSHIBOKEN_API PyTypeObject *get(TypeInitStruct &typeStruct)
         startPos = dotPos + 1;
         AutoDecRef obTypeName(String::fromCppStringView(typeName));
         modOrType = PyObject_GetAttr(modOrType, obTypeName);
-    } while (typeStruct.type == nullptr && dotPos != std::string::npos);
+    } while (currentType(typeStruct) == nullptr && dotPos != std::string::npos);
 
-    return typeStruct.type;
+    return currentType(typeStruct);
 }
 
-static void incarnateHelper(PyObject *module, const std::string_view names,
-                            const NameToTypeFunctionMap &nameToFunc)
+static PyTypeObject *incarnateNestedType(PyObject *module, std::string_view names,
+                                         TypeCreationFunction initFunc)
 {
     auto dotPos = names.find('.');
     std::string::size_type startPos = 0;
@@ -90,19 +380,33 @@ static void incarnateHelper(PyObject *module, const std::string_view names,
         auto typeName = names.substr(startPos, dotPos - startPos);
         AutoDecRef obTypeName(String::fromCppStringView(typeName));
         modOrType = PyObject_GetAttr(modOrType, obTypeName);
+        if (modOrType == nullptr)
+            return nullptr;
         startPos = dotPos + 1;
         dotPos = names.find('.', startPos);
     }
     // now we have the type to create. (May be done already)
-    auto funcIter = nameToFunc.find(std::string(names));
-    if (funcIter == nameToFunc.end())
-        return;
     // - call this function that returns a PyTypeObject
-    auto tcStruct = funcIter->second;
-    auto initFunc = tcStruct.func;
     PyTypeObject *type = initFunc(modOrType);
+    if (type == nullptr)
+        return nullptr;
     auto name = names.substr(startPos);
     PyObject_SetAttrString(modOrType, name.data(), reinterpret_cast<PyObject *>(type));
+    return type;
+}
+
+static void incarnateHelper(PyObject *module, const std::string_view names,
+                            const NameToTypeFunctionMap &nameToFunc)
+{
+    TypeCreationFunction func{};
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        auto funcIter = nameToFunc.find(std::string(names));
+        if (funcIter == nameToFunc.end())
+            return;
+        func = funcIter->second.func;
+    }
+    incarnateNestedType(module, names, func);
 }
 
 static void incarnateSubtypes(PyObject *module,
@@ -115,19 +419,29 @@ static void incarnateSubtypes(PyObject *module,
     }
 }
 
+// Create a type added by AddTypeCreationFunction(). Returns nullptr
+// without error if it does not exist (any more).
 static PyTypeObject *incarnateType(PyObject *module, const char *name,
                                    NameToTypeFunctionMap &nameToFunc)
 {
     // - locate the name and retrieve the generating function
-    auto funcIter = nameToFunc.find(name);
-    if (funcIter == nameToFunc.end()) {
-        // attribute does really not exist.
-        PyErr_SetNone(PyExc_AttributeError);
-        return nullptr;
+    TypeCreationStruct tcStruct{};
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        auto funcIter = nameToFunc.find(name);
+        if (funcIter == nameToFunc.end())
+            return nullptr; // attribute does really not exist.
+        tcStruct = funcIter->second;
     }
-    // - call this function that returns a PyTypeObject
-    auto tcStruct = funcIter->second;
     auto initFunc = tcStruct.func;
+    TypeCreationClaim claim(initFunc, [&nameToFunc, name, initFunc]() {
+        auto funcIter = nameToFunc.find(name);
+        return funcIter != nameToFunc.end() && funcIter->second.func == initFunc;
+    });
+    if (!claim.isClaimed())
+        return nullptr;
+
+    // - call this function that returns a PyTypeObject
     auto *modOrType{module};
 
     // PYSIDE-2404: Make sure that no switching happens during type creation.
@@ -142,8 +456,10 @@ static PyTypeObject *incarnateType(PyObject *module, const char *name,
     Py_INCREF(res);
     PyModule_AddObject(module, name, res);   // steals reference
     // - remove the entry, if not by something cleared.
-    if (!nameToFunc.empty())
-        nameToFunc.erase(funcIter);
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        nameToFunc.erase(name);
+    }
     // - return the PyTypeObject.
     return type;
 }
@@ -153,15 +469,47 @@ static PyTypeObject *incarnateType(PyObject *module, const char *name,
 // the creation of the type(s), this is efficient.
 void loadLazyClassesWithName(const char *name)
 {
-    for (auto const & tableIter : moduleToFuncs) {
-        auto nameToFunc = tableIter.second;
-        auto funcIter = nameToFunc.find(name);
-        if (funcIter != nameToFunc.end()) {
+    struct Candidate
+    {
+        PyObject *module;
+        LazyTypes *lazyTypes;
+        int entry;
+        bool hasFunc;
+    };
+
+    // - collect the candidates and create them outside the lock.
+    std::vector<Candidate> candidates;
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        const std::string_view nameView(name);
+        for (auto &tableIter : moduleToFuncs) {
+            auto &lazyTypes = tableIter.second;
+            int entry = -1;
+            if (lazyTypes.index != nullptr) {
+                entry = findIndexEntry(*lazyTypes.index, nameView);
+                if (entry >= 0 && lazyTypes.created[entry])
+                    entry = -1;
+            }
             // attribute exists in the lazy types.
-            auto *module = tableIter.first;
-            incarnateType(module, name, nameToFunc);
+            const bool hasFunc = lazyTypes.nameToFunc.find(name) != lazyTypes.nameToFunc.end();
+            if (entry >= 0 || hasFunc)
+                candidates.push_back({tableIter.first, &lazyTypes, entry, hasFunc});
         }
     }
+
+    for (const auto &candidate : candidates) {
+        if (candidate.entry >= 0)
+            incarnateIndexEntry(candidate.module, *candidate.lazyTypes, candidate.entry);
+        if (candidate.hasFunc)
+            incarnateType(candidate.module, name, candidate.lazyTypes->nameToFunc);
+    }
+}
+
+// Whether an index entry is a type which is an attribute of the module
+// (as opposed to a nested type of a type of another module).
+static bool isModuleLevelEntry(const TypeCreationEntry &typeEntry)
+{
+    return typeEntry.func != nullptr && std::strchr(typeEntry.name, '.') == nullptr;
 }
 
 // PYSIDE-2404: Completely load all not yet loaded classes.
@@ -169,28 +517,41 @@ void loadLazyClassesWithName(const char *name)
 // PYSIDE-2898: Use a name list to pick the toplevel types.
 void resolveLazyClasses(PyObject *module)
 {
-    // - locate the module in the moduleTofuncs mapping
-    auto tableIter = moduleToFuncs.find(module);
-    if (tableIter == moduleToFuncs.end())
-        return;
-
-    // - see if there are still unloaded elements
-    auto &nameToFunc = tableIter->second;
-
+    LazyTypes *lazyTypes{};
+    std::vector<int> entries;
     // - keep a filtered list of names without the subtypes
     std::vector<std::string> names{};
-    names.reserve(nameToFunc.size());
-    for (const auto &funcIter : nameToFunc) {
-        if (funcIter.first.find('.') == std::string::npos)
-            names.push_back(funcIter.first);
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        // - locate the module in the moduleTofuncs mapping
+        auto tableIter = moduleToFuncs.find(module);
+        if (tableIter == moduleToFuncs.end())
+            return;
+
+        lazyTypes = &tableIter->second;
+        if (const auto *index = lazyTypes->index) {
+            for (int entry = 0; entry < index->entryCount; entry += 1 + index->entries[entry].nestedCount) {
+                if (isModuleLevelEntry(index->entries[entry]) && !lazyTypes->created[entry])
+                    entries.push_back(entry);
+            }
+        }
+
+        // - see if there are still unloaded elements
+        const auto &nameToFunc = lazyTypes->nameToFunc;
+        names.reserve(nameToFunc.size());
+        for (const auto &funcIter : nameToFunc) {
+            if (funcIter.first.find('.') == std::string::npos)
+                names.push_back(funcIter.first);
+        }
     }
 
+    // - incarnate the remaining toplevel types of the index.
+    for (int entry : entries)
+        incarnateIndexEntry(module, *lazyTypes, entry);
+
     // - incarnate all toplevel types. Subtypes are handled there.
-    for (const auto &nameIter : names) {
-        auto funcIter = nameToFunc.find(nameIter);
-        if (funcIter != nameToFunc.end())
-            incarnateType(module, nameIter.c_str(), nameToFunc);
-    }
+    for (const auto &nameIter : names)
+        incarnateType(module, nameIter.c_str(), lazyTypes->nameToFunc);
 }
 
 // PYSIDE-2404: Override the gettattr function of modules.
@@ -208,23 +569,37 @@ static PyObject *PyModule_lazyGetAttro(PyObject *module, PyObject *name)
 
     PyErr_Clear();
     // - locate the module in the moduleTofuncs mapping
-    auto tableIter = moduleToFuncs.find(module);
-    // - if this is not our module, use the original
-    if (tableIter == moduleToFuncs.end())
-        return origModuleGetattro(module, name);
-
-    // - locate the name and retrieve the generating function
-    const char *attrNameStr = Shiboken::String::toCString(name);
-    auto &nameToFunc = tableIter->second;
-    // - create the real type and handle subtypes
-    auto *type = incarnateType(module, attrNameStr, nameToFunc);
-    auto *ret = reinterpret_cast<PyObject *>(type);
-    // - if attribute does really not exist use the original
-    if (ret == nullptr && PyErr_ExceptionMatches(PyExc_AttributeError)) {
-        PyErr_Clear();
-        return origModuleGetattro(module, name);
+    LazyTypes *lazyTypes{};
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        auto tableIter = moduleToFuncs.find(module);
+        if (tableIter != moduleToFuncs.end())
+            lazyTypes = &tableIter->second;
     }
-    return ret;
+    // - if this is our module, create the real type and handle subtypes
+    if (lazyTypes != nullptr) {
+        const char *attrNameStr = _PepUnicode_AsString(name);
+        if (attrNameStr == nullptr)
+            return nullptr;
+        PyTypeObject *type{};
+        if (lazyTypes->index != nullptr) {
+            const int entry = findIndexEntry(*lazyTypes->index, std::string_view(attrNameStr));
+            if (entry >= 0)
+                type = incarnateIndexEntry(module, *lazyTypes, entry);
+        }
+        if (type == nullptr && PyErr_Occurred() == nullptr)
+            type = incarnateType(module, attrNameStr, lazyTypes->nameToFunc);
+        if (type != nullptr)
+            return reinterpret_cast<PyObject *>(type);
+        if (PyErr_Occurred() != nullptr) {
+            if (PyErr_ExceptionMatches(PyExc_AttributeError) == 0)
+                return nullptr;
+            PyErr_Clear();
+        }
+    }
+    // - if this is not our module or the attribute does really not exist
+    //   (or was created meanwhile), use the original
+    return origModuleGetattro(module, name);
 }
 
 // PYSIDE-2404: Supply a new module dir for not yet visible entries.
@@ -237,15 +612,28 @@ static PyObject *_module_dir_template(PyObject * /* self */, PyObject *args)
     if (!PyArg_ParseTuple(args, "O", &module))
         return nullptr;
 
-    auto tableIter = moduleToFuncs.find(module);
-    assert(tableIter != moduleToFuncs.end());
+    // Collect all elements that were not yet in the dict.
+    std::vector<std::string> lazyNames;
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        auto tableIter = moduleToFuncs.find(module);
+        assert(tableIter != moduleToFuncs.end());
+        const auto &lazyTypes = tableIter->second;
+        if (const auto *index = lazyTypes.index) {
+            for (int entry = 0; entry < index->entryCount; entry += 1 + index->entries[entry].nestedCount) {
+                if (isModuleLevelEntry(index->entries[entry]) && !lazyTypes.created[entry])
+                    lazyNames.emplace_back(index->entries[entry].name);
+            }
+        }
+        for (const auto &funcIter : lazyTypes.nameToFunc)
+            lazyNames.push_back(funcIter.first);
+    }
+
     Shiboken::AutoDecRef dict(PyObject_GetAttr(module, _dict));
     auto *ret = PyDict_Keys(dict);
-    // Now add all elements that were not yet in the dict.
-    auto &nameToFunc = tableIter->second;
-    for (const auto &funcIter : nameToFunc) {
-        const char *name = funcIter.first.c_str();
-        Shiboken::AutoDecRef pyName(PyUnicode_FromString(name));
+    // Now add them.
+    for (const auto &name : lazyNames) {
+        Shiboken::AutoDecRef pyName(PyUnicode_FromString(name.c_str()));
         PyList_Append(ret, pyName);
     }
     return ret;
@@ -359,8 +747,7 @@ static int lazyLoadDefault()
     return result;
 }
 
-void checkIfShouldLoadImmediately(PyObject *module, const std::string &name,
-                                  const NameToTypeFunctionMap &nameToFunc)
+static bool shouldLoadImmediately(PyObject *module)
 {
     static const int value = lazyLoadDefault();
 
@@ -372,31 +759,39 @@ void checkIfShouldLoadImmediately(PyObject *module, const std::string &name,
     //   3  - lazy loading for any module.
     //
     // By default we lazy load all known modules (option = 1).
-    if (value == 0                                  // completely disabled
-        || canNotLazyLoad(module)                   // for some reason we cannot lazy load
-        || (value == 1 && !shouldLazyLoad(module))  // not a known module
-        ) {
+    return value == 0                                  // completely disabled
+        || canNotLazyLoad(module)                      // for some reason we cannot lazy load
+        || (value == 1 && !shouldLazyLoad(module));    // not a known module
+}
+
+void checkIfShouldLoadImmediately(PyObject *module, const std::string &name,
+                                  const NameToTypeFunctionMap &nameToFunc)
+{
+    if (shouldLoadImmediately(module))
         incarnateHelper(module, name, nameToFunc);
-    }
 }
 
 void AddTypeCreationFunction(PyObject *module,
                              const char *name,
                              TypeCreationFunction func)
 {
-    // - locate the module in the moduleTofuncs mapping
-    auto tableIter = moduleToFuncs.find(module);
-    assert(tableIter != moduleToFuncs.end());
-    // - Assign the name/generating function tcStruct.
-    auto &nameToFunc = tableIter->second;
-    TypeCreationStruct tcStruct{func, {}};
-    auto nit = nameToFunc.find(name);
-    if (nit == nameToFunc.end())
-        nameToFunc.insert(std::make_pair(name, tcStruct));
-    else
-        nit->second = tcStruct;
+    NameToTypeFunctionMap *nameToFunc{};
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        // - locate the module in the moduleTofuncs mapping
+        auto tableIter = moduleToFuncs.find(module);
+        assert(tableIter != moduleToFuncs.end());
+        // - Assign the name/generating function tcStruct.
+        nameToFunc = &tableIter->second.nameToFunc;
+        TypeCreationStruct tcStruct{func, {}};
+        auto nit = nameToFunc->find(name);
+        if (nit == nameToFunc->end())
+            nameToFunc->insert(std::make_pair(name, tcStruct));
+        else
+            nit->second = tcStruct;
+    }
 
-    checkIfShouldLoadImmediately(module, name, nameToFunc);
+    checkIfShouldLoadImmediately(module, name, *nameToFunc);
 }
 
 void AddTypeCreationFunction(PyObject *module,
@@ -404,24 +799,49 @@ void AddTypeCreationFunction(PyObject *module,
                              TypeCreationFunction func,
                              const char *namePath)
 {
-    // - locate the module in the moduleTofuncs mapping
-    auto tableIter = moduleToFuncs.find(module);
-    assert(tableIter != moduleToFuncs.end());
-    // - Assign the name/generating function tcStruct.
-    auto &nameToFunc = tableIter->second;
-    auto nit = nameToFunc.find(containerName);
-
-    // - insert namePath into the subtype vector of the main type.
-    nit->second.subtypeNames.emplace_back(namePath);
-    // - insert it also as its own entry.
-    nit = nameToFunc.find(namePath);
-    TypeCreationStruct tcStruct{func, {}};
-    if (nit == nameToFunc.end())
-        nameToFunc.insert(std::make_pair(namePath, tcStruct));
-    else
-        nit->second = tcStruct;
+    NameToTypeFunctionMap *nameToFunc{};
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        // - locate the module in the moduleTofuncs mapping
+        auto tableIter = moduleToFuncs.find(module);
+        assert(tableIter != moduleToFuncs.end());
+        // - Assign the name/generating function tcStruct.
+        nameToFunc = &tableIter->second.nameToFunc;
+        auto nit = nameToFunc->find(containerName);
+
+        // - insert namePath into the subtype vector of the main type.
+        nit->second.subtypeNames.emplace_back(namePath);
+        // - insert it also as its own entry.
+        nit = nameToFunc->find(namePath);
+        TypeCreationStruct tcStruct{func, {}};
+        if (nit == nameToFunc->end())
+            nameToFunc->insert(std::make_pair(namePath, tcStruct));
+        else
+            nit->second = tcStruct;
+    }
 
-    checkIfShouldLoadImmediately(module, namePath, nameToFunc);
+    checkIfShouldLoadImmediately(module, namePath, *nameToFunc);
+}
+
+void AddTypeCreationIndex(PyObject *module, const TypeCreationIndex *index)
+{
+    LazyTypes *lazyTypes{};
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        // - locate the module in the moduleTofuncs mapping
+        auto tableIter = moduleToFuncs.find(module);
+        assert(tableIter != moduleToFuncs.end());
+        lazyTypes = &tableIter->second;
+        lazyTypes->index = index;
+        lazyTypes->created.assign(std::size_t(index->entryCount), false);
+    }
+
+    if (shouldLoadImmediately(module)) {
+        for (int entry = 0; entry < index->entryCount; entry += 1 + index->entries[entry].nestedCount) {
+            if (index->entries[entry].func != nullptr)
+                incarnateIndexEntry(module, *lazyTypes, entry);
+        }
+    }
 }
 
 PyObject *import(const char *moduleName)
@@ -483,8 +903,10 @@ PyObject *create(const char * /* modName */, void *moduleData)
     auto *moduleDir = PyObject_CallFunctionObjArgs(partial, moduleDirTemplate, module, nullptr);
     PyModule_AddObject(module, module_methods->ml_name, moduleDir);  // steals reference
     // Insert an initial empty table for the module.
-    NameToTypeFunctionMap empty;
-    moduleToFuncs.insert(std::make_pair(module, empty));
+    {
+        ModuleTablesLocker locker(moduleTablesMutex);
+        moduleToFuncs.insert(std::make_pair(module, LazyTypes{}));
+    }
 
     // A star import must be done unconditionally. Use the complete name.
     if (isImportStar(module))
@@ -515,6 +937,7 @@ PyObject *create(const char * /* modName */, void *moduleData)
 
 void registerTypes(PyObject *module, TypeInitStruct *types)
 {
+    ModuleTablesLocker locker(moduleTablesMutex);
     auto iter = moduleTypes.find(module);
     if (iter == moduleTypes.end())
         moduleTypes.insert(std::make_pair(module, types));
@@ -522,12 +945,14 @@ void registerTypes(PyObject *module, TypeInitStruct *types)
 
 TypeInitStruct *getTypes(PyObject *module)
 {
+    ModuleTablesLocker locker(moduleTablesMutex);
     auto iter = moduleTypes.find(module);
     return (iter == moduleTypes.end()) ? 0 : iter->second;
 }
 
 void registerTypeConverters(PyObject *module, SbkConverter **converters)
 {
+    ModuleTablesLocker locker(moduleTablesMutex);
     auto iter = moduleConverters.find(module);
     if (iter == moduleConverters.end())
         moduleConverters.insert(std::make_pair(module, converters));
@@ -535,6 +960,7 @@ void registerTypeConverters(PyObject *module, SbkConverter **converters)
 
 SbkConverter **getTypeConverters(PyObject *module)
 {
+    ModuleTablesLocker locker(moduleTablesMutex);
     auto iter = moduleConverters.find(module);
     return (iter == moduleConverters.end()) ? 0 : iter->second;
 }
@@ -56,6 +56,35 @@ LIBSHIBOKEN_API void AddTypeCreationFunction(PyObject *module,
                                              TypeCreationFunction func,
                                              const char *containerName);
 
+/// Entry of the generated lazy type creation index.
+struct TypeCreationEntry
+{
+    const char *name;           // Python name path, "Outer.Inner" for nested types
+    TypeCreationFunction func;  // nullptr if the type is disabled by a configuration
+    int nestedCount;            // Number of following entries nested into a top-level type
+};
+
+/// Generated lazy type creation index of a module. The entries are ordered
+/// by top-level type, each followed by its nested types. Nested types whose
+/// top-level type belongs to another module are top-level entries named by
+/// their name path. The top-level names are found by a minimal perfect hash
+/// computed by the generator:
+/// bucket = hash(name, 0) % slotCount; displacement d = displacements[bucket];
+/// slot = d < 0 ? -d - 1 : hash(name, d) % slotCount; entry = slots[slot].
+/// hash() is a seeded FNV-1a hash (see typeNameHash() in sbkmodule.cpp).
+struct TypeCreationIndex
+{
+    const TypeCreationEntry *entries;
+    int entryCount;
+    const int *slots;           // Entry index per slot
+    const int *displacements;   // Displacement per bucket
+    int slotCount;              // Number of top-level types
+};
+
+/// PYSIDE-2404: Adds the type creation functions of a module in one go,
+/// replacing AddTypeCreationFunction() for generated modules.
+LIBSHIBOKEN_API void AddTypeCreationIndex(PyObject *module, const TypeCreationIndex *index);
+
 /**
  *  Registers the list of types created by \p module.
  *  \param module   Module where the types were created.
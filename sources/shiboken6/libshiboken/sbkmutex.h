@@ -0,0 +1,88 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef SBKMUTEX_H
+#define SBKMUTEX_H
+
+#include "sbkpython.h"
+
+#ifdef Py_GIL_DISABLED
+#  include <mutex>
+#endif
+
+// Helpers protecting global and per-object state which the GIL protects
+// on regular builds. On free-threaded builds (Py_GIL_DISABLED), they map to
+// real locks; otherwise, they compile to nothing.
+
+namespace Shiboken
+{
+
+#ifdef Py_GIL_DISABLED
+using Mutex = std::mutex;
+using RecursiveMutex = std::recursive_mutex;
+#else
+/// No-op lock for state protected by the GIL.
+struct NoOpMutex
+{
+    void lock() noexcept {}
+    bool try_lock() noexcept { return true; }
+    void unlock() noexcept {}
+};
+
+using Mutex = NoOpMutex;
+using RecursiveMutex = NoOpMutex;
+#endif
+
+/// Locks \p mutex while holding an attached thread state. If the mutex is
+/// taken, the thread state is detached while waiting so that the holder can
+/// run Python code (which may need a stop-the-world pause) without deadlock.
+/// Mutexes locked by plain std::lock_guard must not be held when calling
+/// into Python.
+template <class MutexType>
+class DetachingLocker
+{
+public:
+    DetachingLocker(const DetachingLocker &) = delete;
+    DetachingLocker &operator=(const DetachingLocker &) = delete;
+    DetachingLocker(DetachingLocker &&) = delete;
+    DetachingLocker &operator=(DetachingLocker &&) = delete;
+
+    explicit DetachingLocker(MutexType &mutex) : m_mutex(mutex)
+    {
+        if (!m_mutex.try_lock()) {
+            Py_BEGIN_ALLOW_THREADS
+            m_mutex.lock();
+            Py_END_ALLOW_THREADS
+        }
+    }
+
+    ~DetachingLocker() { m_mutex.unlock(); }
+
+private:
+    MutexType &m_mutex;
+};
+
+/// Per-object critical section (PEP 703) protecting the state of a wrapper
+/// on free-threaded builds.
+class CriticalSection
+{
+public:
+    CriticalSection(const CriticalSection &) = delete;
+    CriticalSection &operator=(const CriticalSection &) = delete;
+    CriticalSection(CriticalSection &&) = delete;
+    CriticalSection &operator=(CriticalSection &&) = delete;
+
+#ifdef Py_GIL_DISABLED
+    explicit CriticalSection(PyObject *object) { PyCriticalSection_Begin(&m_section, object); }
+    ~CriticalSection() { PyCriticalSection_End(&m_section); }
+
+private:
+    PyCriticalSection m_section;
+#else
+    explicit CriticalSection(PyObject *) noexcept {}
+#endif
+};
+
+} // namespace Shiboken
+
+#endif // SBKMUTEX_H
@@ -4,9 +4,12 @@
 // included by sbknumpy.cpp
 
 #include "helper.h"
+#include <complex>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 #include <optional>
+#include <type_traits>
 
 #ifdef HAVE_NUMPY
 
@@ -48,42 +51,65 @@ static std::optional<View::Type> viewTypeFromNumPy(int npt)
         return View::Float;
     case NPY_DOUBLE:
         return View::Double;
+    case NPY_BYTE:
+        return View::Int8;
+    case NPY_UBYTE:
+        return View::Unsigned8;
+    case NPY_BOOL:
+        return View::Bool;
+    case NPY_HALF:
+        return View::Float16;
+    case NPY_CFLOAT:
+        return View::ComplexFloat;
+    case NPY_CDOUBLE:
+        return View::ComplexDouble;
     default:
         break;
     }
     return {};
 }
 
-View View::fromPyObject(PyObject *pyIn)
+View View::fromPyObjectStrided(PyObject *pyIn)
 {
+    initNumPy();
     if (pyIn == nullptr || PyArray_Check(pyIn) == 0)
         return {};
     auto *ar = reinterpret_cast<PyArrayObject *>(pyIn);
-    if ((PyArray_FLAGS(ar) & NPY_ARRAY_C_CONTIGUOUS) == 0)
-        return {};
     const int ndim = PyArray_NDIM(ar);
-    if (ndim > 2)
+    if (ndim == 0 || ndim > maxDimensions)
         return {};
 
     const auto typeO = viewTypeFromNumPy(PyArray_TYPE(ar));
-    if (!typeO.has_value())
+    if (!typeO.has_value() || PyArray_ISBYTESWAPPED(ar))
         return {};
 
     View result;
     result.ndim = ndim;
     result.type = typeO.value();
     result.data = PyArray_DATA(ar);
-    result.dimensions[0] = PyArray_DIMS(ar)[0];
-    result.stride[0] = PyArray_STRIDES(ar)[0];
-    if (ndim > 1) {
-        result.dimensions[1] = PyArray_DIMS(ar)[1];
-        result.stride[1] = PyArray_STRIDES(ar)[1];
-    } else {
-        result.dimensions[1] = result.stride[1] = 0;
+    for (int d = 0; d < ndim; ++d) {
+        result.dimensions[d] = PyArray_DIMS(ar)[d];
+        result.stride[d] = PyArray_STRIDES(ar)[d];
     }
     return result;
 }
 
+View View::fromPyObject(PyObject *pyIn)
+{
+    if (pyIn == nullptr || PyArray_Check(pyIn) == 0)
+        return {};
+    auto *ar = reinterpret_cast<PyArrayObject *>(pyIn);
+    if ((PyArray_FLAGS(ar) & NPY_ARRAY_C_CONTIGUOUS) == 0 || PyArray_NDIM(ar) > 2)
+        return {};
+
+    View result = fromPyObjectStrided(pyIn);
+    if (result.type > Unsigned64)
+        return {};
+    if (result.ndim == 1)
+        result.dimensions[1] = result.stride[1] = 0;
+    return result;
+}
+
 } // namespace Numpy
 
 template <class T>
@@ -219,6 +245,11 @@ View View::fromPyObject(PyObject *)
     return {};
 }
 
+View View::fromPyObjectStrided(PyObject *)
+{
+    return {};
+}
+
 std::ostream &operator<<(std::ostream &str, const debugPyArrayObject &)
 {
     str << "Unimplemented function " <<  __FUNCTION__ << ", (numpy was not found).";
@@ -240,20 +271,264 @@ bool View::sameLayout(const View &rhs) const
 bool View::sameSize(const View &rhs) const
 {
     return sameLayout(rhs)
-        && dimensions[0] == rhs.dimensions[0] && dimensions[1] == rhs.dimensions[1];
+        && std::equal(dimensions, dimensions + ndim, rhs.dimensions);
+}
+
+int View::elementSize(Type t)
+{
+    switch (t) {
+    case Int8:
+    case Unsigned8:
+    case Bool:
+        return 1;
+    case Int16:
+    case Unsigned16:
+    case Float16:
+        return 2;
+    case Int:
+    case Unsigned:
+    case Float:
+        return 4;
+    case Int64:
+    case Unsigned64:
+    case Double:
+    case ComplexFloat:
+        return 8;
+    case ComplexDouble:
+        return 16;
+    }
+    return 0;
+}
+
+// IEEE 754 half precision, for numpy.float16
+struct Half
+{
+    uint16_t bits;
+};
+
+static float halfToFloat(Half h)
+{
+    const uint32_t sign = uint32_t(h.bits & 0x8000u) << 16;
+    uint32_t exponent = (h.bits >> 10) & 0x1Fu;
+    uint32_t mantissa = h.bits & 0x3FFu;
+    uint32_t result{};
+    if (exponent == 0x1Fu) { // Inf/NaN
+        result = sign | 0x7F800000u | (mantissa << 13);
+    } else if (exponent != 0) { // Normalized
+        result = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    } else if (mantissa != 0) { // Subnormal, normalize
+        exponent = 113;
+        while ((mantissa & 0x400u) == 0) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        result = sign | (exponent << 23) | ((mantissa & 0x3FFu) << 13);
+    } else {
+        result = sign;
+    }
+    float f;
+    std::memcpy(&f, &result, sizeof(f));
+    return f;
+}
+
+template <class T>
+struct IsComplex : std::false_type {};
+template <class T>
+struct IsComplex<std::complex<T>> : std::true_type {};
+
+template <class Target, class Source>
+static inline Target convertElement(Source v)
+{
+    if constexpr (std::is_same_v<Source, Half>)
+        return convertElement<Target>(halfToFloat(v));
+    else if constexpr (std::is_same_v<Target, bool>)
+        return v != Source{};
+    else if constexpr (IsComplex<Target>::value && !IsComplex<Source>::value)
+        return Target(typename Target::value_type(v), 0);
+    else
+        return static_cast<Target>(v);
+}
+
+using ConvertRowFunc = void (*)(const char *source, Py_ssize_t sourceStride,
+                                char *target, Py_ssize_t targetStride, Py_ssize_t n);
+
+// Convert a row of elements. The loop over aligned, dense rows is kept simple
+// so that the compiler can vectorize it.
+template <class Source, class Target>
+static void convertRow(const char *source, Py_ssize_t sourceStride,
+                       char *target, Py_ssize_t targetStride, Py_ssize_t n)
+{
+    const bool aligned = reinterpret_cast<uintptr_t>(source) % alignof(Source) == 0
+                         && reinterpret_cast<uintptr_t>(target) % alignof(Target) == 0;
+    if (aligned && sourceStride == Py_ssize_t(sizeof(Source))
+        && targetStride == Py_ssize_t(sizeof(Target))) {
+        if constexpr (std::is_same_v<Source, Target>) {
+            std::memcpy(target, source, n * sizeof(Target));
+        } else {
+            auto *s = reinterpret_cast<const Source *>(source);
+            auto *t = reinterpret_cast<Target *>(target);
+            for (Py_ssize_t i = 0; i < n; ++i)
+                t[i] = convertElement<Target>(s[i]);
+        }
+        return;
+    }
+    for (Py_ssize_t i = 0; i < n; ++i) {
+        Source s;
+        std::memcpy(&s, source, sizeof(Source));
+        const auto t = convertElement<Target>(s);
+        std::memcpy(target, &t, sizeof(Target));
+        source += sourceStride;
+        target += targetStride;
+    }
+}
+
+template <class Source>
+static ConvertRowFunc convertRowFunc(View::Type target)
+{
+    if constexpr (IsComplex<Source>::value) {
+        switch (target) {
+        case View::ComplexFloat:
+            return convertRow<Source, std::complex<float>>;
+        case View::ComplexDouble:
+            return convertRow<Source, std::complex<double>>;
+        default:
+            return nullptr;
+        }
+    } else {
+        switch (target) {
+        case View::Int:
+            return convertRow<Source, int32_t>;
+        case View::Unsigned:
+            return convertRow<Source, uint32_t>;
+        case View::Float:
+            return convertRow<Source, float>;
+        case View::Double:
+            return convertRow<Source, double>;
+        case View::Int16:
+            return convertRow<Source, int16_t>;
+        case View::Unsigned16:
+            return convertRow<Source, uint16_t>;
+        case View::Int64:
+            return convertRow<Source, int64_t>;
+        case View::Unsigned64:
+            return convertRow<Source, uint64_t>;
+        case View::Int8:
+            return convertRow<Source, int8_t>;
+        case View::Unsigned8:
+            return convertRow<Source, uint8_t>;
+        case View::Bool:
+            return convertRow<Source, bool>;
+        case View::Float16:
+            return nullptr;
+        case View::ComplexFloat:
+            return convertRow<Source, std::complex<float>>;
+        case View::ComplexDouble:
+            return convertRow<Source, std::complex<double>>;
+        }
+    }
+    return nullptr;
+}
+
+static ConvertRowFunc convertRowFunc(View::Type source, View::Type target)
+{
+    switch (source) {
+    case View::Int:
+        return convertRowFunc<int32_t>(target);
+    case View::Unsigned:
+        return convertRowFunc<uint32_t>(target);
+    case View::Float:
+        return convertRowFunc<float>(target);
+    case View::Double:
+        return convertRowFunc<double>(target);
+    case View::Int16:
+        return convertRowFunc<int16_t>(target);
+    case View::Unsigned16:
+        return convertRowFunc<uint16_t>(target);
+    case View::Int64:
+        return convertRowFunc<int64_t>(target);
+    case View::Unsigned64:
+        return convertRowFunc<uint64_t>(target);
+    case View::Int8:
+        return convertRowFunc<int8_t>(target);
+    case View::Unsigned8:
+        return convertRowFunc<uint8_t>(target);
+    case View::Bool:
+        return convertRowFunc<bool>(target);
+    case View::Float16:
+        return convertRowFunc<Half>(target);
+    case View::ComplexFloat:
+        return convertRowFunc<std::complex<float>>(target);
+    case View::ComplexDouble:
+        return convertRowFunc<std::complex<double>>(target);
+    }
+    return nullptr;
+}
+
+bool View::copyTo(Type targetType, void *target, Py_ssize_t targetStride) const
+{
+    auto convertFunc = convertRowFunc(type, targetType);
+    if (ndim == 0 || convertFunc == nullptr)
+        return false;
+
+    // Drop dimensions of size 1 and merge dimensions that are contiguous
+    // with respect to each other, so that the innermost row is as long
+    // as possible (a single row for C-contiguous arrays).
+    Py_ssize_t dims[maxDimensions];
+    Py_ssize_t strides[maxDimensions];
+    int n = 0;
+    for (int d = 0; d < ndim; ++d) {
+        if (dimensions[d] == 0)
+            return true;
+        if (dimensions[d] == 1)
+            continue;
+        if (n > 0 && strides[n - 1] == stride[d] * dimensions[d]) {
+            dims[n - 1] *= dimensions[d];
+            strides[n - 1] = stride[d];
+        } else {
+            dims[n] = dimensions[d];
+            strides[n] = stride[d];
+            ++n;
+        }
+    }
+    if (n == 0) { // Single element
+        dims[0] = 1;
+        strides[0] = elementSize(type);
+        n = 1;
+    }
+
+    const int inner = n - 1;
+    Py_ssize_t rows = 1;
+    for (int d = 0; d < inner; ++d)
+        rows *= dims[d];
+
+    Py_ssize_t index[maxDimensions] = {};
+    auto *source = reinterpret_cast<const char *>(data);
+    auto *targetData = reinterpret_cast<char *>(target);
+    const Py_ssize_t targetRowStride = dims[inner] * targetStride;
+    for (Py_ssize_t r = 0; r < rows; ++r) {
+        convertFunc(source, strides[inner], targetData, targetStride, dims[inner]);
+        targetData += targetRowStride;
+        for (int d = inner - 1; d >= 0; --d) {
+            source += strides[d];
+            if (++index[d] < dims[d])
+                break;
+            source -= strides[d] * dims[d];
+            index[d] = 0;
+        }
+    }
+    return true;
 }
 
 std::ostream &operator<<(std::ostream &str, const View &v)
 {
     str << "Shiboken::Numpy::View(";
     if (v) {
-        str << "type=" << v.type << ", ndim=" << v.ndim << " ["
-            << v.dimensions[0];
-        if (v.ndim > 1)
-           str << ", " << v.dimensions[1];
-        str << "], stride=[" << v.stride[0];
-        if (v.ndim > 1)
-           str << ", " << v.stride[1];
+        str << "type=" << v.type << ", ndim=" << v.ndim << " [";
+        for (int d = 0; d < v.ndim; ++d)
+            str << (d ? ", " : "") << v.dimensions[d];
+        str << "], stride=[";
+        for (int d = 0; d < v.ndim; ++d)
+            str << (d ? ", " : "") << v.stride[d];
         str << "], data=" << v.data;
     } else {
         str << "invalid";
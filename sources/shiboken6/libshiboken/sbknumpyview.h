@@ -17,14 +17,24 @@ namespace Shiboken::Numpy
 /// \return Whether it is a PyArrayObject
 LIBSHIBOKEN_API bool check(PyObject *pyIn);
 
-/// A simple view of an up to 2 dimensional, C-contiguous array of a standard
-/// type. It can be passed to compilation units that do not include the
-/// numpy headers.
+/// A view of a strided, n-dimensional array of a standard type. It can be
+/// passed to compilation units that do not include the numpy headers.
+/// Note: The size of the struct is part of the ABI of libshiboken. Changing
+/// it (as done by raising the number of dimensions from 2 to maxDimensions)
+/// requires a new SO version, so it may only be done in a minor release.
 struct LIBSHIBOKEN_API View
 {
-    enum Type { Int, Unsigned, Float, Double, Int16, Unsigned16, Int64, Unsigned64 };
+    enum Type { Int, Unsigned, Float, Double, Int16, Unsigned16, Int64, Unsigned64,
+                Int8, Unsigned8, Bool, Float16, ComplexFloat, ComplexDouble };
 
+    static constexpr int maxDimensions = 32;
+
+    /// Create a view of a C-contiguous array of up to 2 dimensions of the
+    /// types Int..Unsigned64 for code accessing the data directly.
     static View fromPyObject(PyObject *pyIn);
+    /// Create a view of an array of any layout (slices, Fortran order) and
+    /// any of the types. Use copyTo() to access the data.
+    static View fromPyObjectStrided(PyObject *pyIn);
 
     operator bool() const { return ndim > 0; }
 
@@ -33,9 +43,17 @@ struct LIBSHIBOKEN_API View
     /// Return whether rhs is of the same type dimensionality and size
     bool sameSize(const View &rhs) const;
 
+    /// Copy all elements in C order to target, converting them to
+    /// targetType. The elements are written targetStride bytes apart, which
+    /// allows for filling in members of structs (x of QPointF).
+    /// \return false if the conversion is not supported (complex to real)
+    bool copyTo(Type targetType, void *target, Py_ssize_t targetStride) const;
+
+    static int elementSize(Type t);
+
     int ndim = 0;
-    Py_ssize_t dimensions[2];
-    Py_ssize_t stride[2];
+    Py_ssize_t dimensions[maxDimensions];
+    Py_ssize_t stride[maxDimensions];
     void *data = nullptr;
     Type type = Int;
 };
@@ -0,0 +1,76 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "sbkoverloadcache.h"
+#include "basewrapper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace Shiboken
+{
+
+// Starts at 1 so that default-constructed entries never match.
+static std::atomic<unsigned> overloadCacheGeneration{1};
+
+void OverloadCache::invalidate()
+{
+    overloadCacheGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+// The result of the type checks of static types cannot change. Attribute
+// changes of wrapper types invalidate the caches (SbkObjectType_tp_setattro()).
+// Other heap types (plain Python classes) may get for example number protocol
+// methods assigned unnoticed.
+static bool isCacheableType(PyTypeObject *type)
+{
+    return (PyType_GetFlags(type) & Py_TPFLAGS_HEAPTYPE) == 0 || SbkObjectType_Check(type);
+}
+
+bool OverloadCache::lookup(PyObject *const *args, Py_ssize_t numArgs,
+                           int *overloadId, Conversions::PythonToCppConversion *conversions,
+                           Py_ssize_t conversionCount, unsigned *generation)
+{
+    *generation = overloadCacheGeneration.load(std::memory_order_relaxed);
+    if (numArgs > MaxArguments || conversionCount > MaxArguments)
+        return false;
+
+    std::lock_guard<Mutex> locker(m_mutex);
+    for (const Entry &entry : m_entries) {
+        if (entry.generation == *generation && entry.numArgs == numArgs
+            && std::equal(args, args + numArgs, entry.types,
+                          [](PyObject *arg, PyTypeObject *type) { return Py_TYPE(arg) == type; })) {
+            *overloadId = entry.overloadId;
+            std::copy(entry.conversions, entry.conversions + conversionCount, conversions);
+            return true;
+        }
+    }
+    return false;
+}
+
+void OverloadCache::store(PyObject *const *args, Py_ssize_t numArgs,
+                          int overloadId, const Conversions::PythonToCppConversion *conversions,
+                          Py_ssize_t conversionCount, unsigned generation)
+{
+    if (overloadId < 0 || numArgs > MaxArguments || conversionCount > MaxArguments
+        || generation != overloadCacheGeneration.load(std::memory_order_relaxed)) {
+        return;
+    }
+    for (Py_ssize_t i = 0; i < numArgs; ++i) {
+        if (!isCacheableType(Py_TYPE(args[i])))
+            return;
+    }
+
+    std::lock_guard<Mutex> locker(m_mutex);
+    Entry &entry = m_entries[m_next];
+    m_next = (m_next + 1) % Size;
+    for (Py_ssize_t i = 0; i < numArgs; ++i)
+        entry.types[i] = Py_TYPE(args[i]);
+    std::copy(conversions, conversions + conversionCount, entry.conversions);
+    entry.numArgs = numArgs;
+    entry.overloadId = overloadId;
+    entry.generation = generation;
+}
+
+} // namespace Shiboken
@@ -0,0 +1,65 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef SBKOVERLOADCACHE_H
+#define SBKOVERLOADCACHE_H
+
+#include "sbkpython.h"
+#include "shibokenmacros.h"
+#include "sbkconverter.h"
+#include "sbkmutex.h"
+
+namespace Shiboken
+{
+
+/// Inline cache of the overload decisor of a function (generator option
+/// --use-overload-cache). It maps the types of the positional arguments to the
+/// id of the overload found and the Python to C++ conversions determined by
+/// the type checks, so that repeated calls with the same argument types skip
+/// the type checks.
+///
+/// Only argument types whose relevant properties cannot change unnoticed are
+/// cached: static (non-heap) types and wrapper types. Entries are invalidated
+/// when attributes of wrapper types are set, when wrapper types are deleted
+/// and when converters are modified.
+class LIBSHIBOKEN_API OverloadCache
+{
+public:
+    static constexpr Py_ssize_t MaxArguments = 8;
+
+    /// Looks up the types of \p args. On a hit, sets \p overloadId and
+    /// copies \p conversionCount conversions to \p conversions. On a miss,
+    /// returns the generation to be passed to store().
+    bool lookup(PyObject *const *args, Py_ssize_t numArgs,
+                int *overloadId, Conversions::PythonToCppConversion *conversions,
+                Py_ssize_t conversionCount, unsigned *generation);
+
+    /// Stores the result of the overload decisor for the types of \p args
+    /// unless the generation changed meanwhile or a type cannot be cached.
+    void store(PyObject *const *args, Py_ssize_t numArgs,
+               int overloadId, const Conversions::PythonToCppConversion *conversions,
+               Py_ssize_t conversionCount, unsigned generation);
+
+    /// Invalidates all overload caches.
+    static void invalidate();
+
+private:
+    static constexpr int Size = 4;
+
+    struct Entry
+    {
+        PyTypeObject *types[MaxArguments] = {};
+        Conversions::PythonToCppConversion conversions[MaxArguments] = {};
+        Py_ssize_t numArgs = -1;
+        int overloadId = -1;
+        unsigned generation = 0;
+    };
+
+    Entry m_entries[Size];
+    int m_next = 0;
+    Mutex m_mutex;
+};
+
+} // namespace Shiboken
+
+#endif // SBKOVERLOADCACHE_H
@@ -72,6 +72,8 @@ STATIC_STRING_IMPL(builtins, "__builtins__")
 STATIC_STRING_IMPL(dictoffset, "__dictoffset__")
 STATIC_STRING_IMPL(func, "__func__")
 STATIC_STRING_IMPL(func_kind, "__func_kind__")
+STATIC_STRING_IMPL(getattr, "__getattr__")
+STATIC_STRING_IMPL(getattribute, "__getattribute__")
 STATIC_STRING_IMPL(iter, "__iter__")
 STATIC_STRING_IMPL(mro, "__mro__")
 STATIC_STRING_IMPL(new_, "__new__")
@@ -26,6 +26,8 @@ PyObject *builtins();
 PyObject *code();
 PyObject *dictoffset();
 PyObject *func_kind();
+PyObject *getattr();
+PyObject *getattribute();
 PyObject *iter();
 PyObject *module();
 PyObject *mro();
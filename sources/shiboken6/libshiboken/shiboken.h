@@ -17,6 +17,7 @@
 #include "sbkenum.h"
 #include "sbkerrors.h"
 #include "sbkmodule.h"
+#include "sbkoverloadcache.h"
 #include "sbkstring.h"
 #include "sbkstaticstrings.h"
 #include "sbktypefactory.h"
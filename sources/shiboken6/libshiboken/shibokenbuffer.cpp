@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "shibokenbuffer.h"
+#include "basewrapper.h"
+#include "sbktypefactory.h"
+
 #include <cstdlib>
 #include <cstring>
 
@@ -45,6 +48,17 @@ void *Shiboken::Buffer::copyData(PyObject *pyObj, Py_ssize_t *sizeIn)
     return result;
 }
 
+Shiboken::Buffer::WritableBuffer::WritableBuffer(PyObject *pyObj)
+{
+    m_valid = PyObject_GetBuffer(pyObj, &m_view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) == 0;
+}
+
+Shiboken::Buffer::WritableBuffer::~WritableBuffer()
+{
+    if (m_valid)
+        PyBuffer_Release(&m_view);
+}
+
 PyObject *Shiboken::Buffer::newObject(void *memory, Py_ssize_t size, Type type)
 {
     if (size == 0)
@@ -68,3 +82,165 @@ PyObject *Shiboken::Buffer::newObject(const void *memory, Py_ssize_t size)
 {
     return newObject(const_cast<void *>(memory), size, ReadOnly);
 }
+
+// Data of a buffer filled in by fillInfo(), which must remain valid until
+// the buffer is released
+struct BufferInfo
+{
+    Shiboken::Buffer::Layout layout;
+    PyObject *owner = nullptr;
+};
+
+static bool isContiguous(const Shiboken::Buffer::Layout &layout, bool fortranOrder)
+{
+    Py_ssize_t expected = layout.itemSize;
+    for (int i = 0; i < layout.ndim; ++i) {
+        const int d = fortranOrder ? i : layout.ndim - 1 - i;
+        if (layout.shape[d] != 1 && layout.strides[d] != expected)
+            return false;
+        expected *= layout.shape[d];
+    }
+    return true;
+}
+
+int Shiboken::Buffer::fillInfo(Py_buffer *view, PyObject *obj, void *memory,
+                               const Layout &layout, Type type, int flags,
+                               PyObject *owner)
+{
+    if (view == nullptr)
+        return -1;
+
+    const bool readOnly = type == ReadOnly;
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && readOnly) {
+        PyErr_SetString(PyExc_BufferError, "Object is not writable.");
+        return -1;
+    }
+    const bool cContiguous = isContiguous(layout, false);
+    if (!cContiguous) {
+        if ((flags & PyBUF_STRIDES) != PyBUF_STRIDES
+            || (flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS
+            || ((flags & PyBUF_ANY_CONTIGUOUS) == PyBUF_ANY_CONTIGUOUS
+                && !isContiguous(layout, true))) {
+            PyErr_SetString(PyExc_BufferError, "Object is not C-contiguous.");
+            return -1;
+        }
+    }
+    if ((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS && !isContiguous(layout, true)) {
+        PyErr_SetString(PyExc_BufferError, "Object is not Fortran-contiguous.");
+        return -1;
+    }
+
+    auto *internal = new BufferInfo{layout, owner};
+    Py_XINCREF(owner);
+    Py_ssize_t len = layout.itemSize;
+    for (int d = 0; d < layout.ndim; ++d)
+        len *= layout.shape[d];
+
+    const bool withShape = (flags & PyBUF_ND) == PyBUF_ND;
+    view->obj = obj;
+    Py_XINCREF(obj);
+    view->buf = memory;
+    view->len = len;
+    view->readonly = readOnly ? 1 : 0;
+    view->itemsize = layout.itemSize;
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT
+        ? const_cast<char *>(internal->layout.format) : nullptr;
+    view->ndim = withShape ? layout.ndim : 1;
+    view->shape = withShape ? internal->layout.shape : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES
+        ? internal->layout.strides : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = internal;
+    return 0;
+}
+
+void Shiboken::Buffer::releaseInfo(Py_buffer *view)
+{
+    auto *internal = static_cast<BufferInfo *>(view->internal);
+    if (internal != nullptr) {
+        Py_XDECREF(internal->owner);
+        delete internal;
+        view->internal = nullptr;
+    }
+}
+
+// An object exporting a strided memory block while keeping its owner
+// alive, from which the memoryview returned by newObject() is created.
+extern "C"
+{
+
+struct SbkBufferExporter
+{
+    PyObject_HEAD
+    void *memory;
+    PyObject *owner;
+    Shiboken::Buffer::Layout layout;
+    Shiboken::Buffer::Type type;
+};
+
+static void SbkBufferExporter_dealloc(PyObject *self)
+{
+    Py_XDECREF(reinterpret_cast<SbkBufferExporter *>(self)->owner);
+    Sbk_object_dealloc(self);
+}
+
+static int SbkBufferExporter_getbuffer(PyObject *obj, Py_buffer *view, int flags)
+{
+    auto *exporter = reinterpret_cast<SbkBufferExporter *>(obj);
+    return Shiboken::Buffer::fillInfo(view, obj, exporter->memory, exporter->layout,
+                                      exporter->type, flags);
+}
+
+static void SbkBufferExporter_releasebuffer(PyObject *, Py_buffer *view)
+{
+    Shiboken::Buffer::releaseInfo(view);
+}
+
+static PyBufferProcs SbkBufferExporterBufferProc = {
+    (getbufferproc)SbkBufferExporter_getbuffer,           // bf_getbuffer
+    (releasebufferproc)SbkBufferExporter_releasebuffer    // bf_releasebuffer
+};
+
+static PyTypeObject *createBufferExporterType()
+{
+    PyType_Slot SbkBufferExporterType_slots[] = {
+        {Py_tp_dealloc, reinterpret_cast<void *>(SbkBufferExporter_dealloc)},
+        {0, nullptr}
+    };
+
+    PyType_Spec SbkBufferExporterType_spec = {
+        "2:shiboken6.Shiboken.BufferExporter",
+        sizeof(SbkBufferExporter),
+        0,
+        Py_TPFLAGS_DEFAULT,
+        SbkBufferExporterType_slots,
+    };
+
+    return SbkType_FromSpec_BMDWB(&SbkBufferExporterType_spec,
+                                  nullptr, nullptr, 0, 0,
+                                  &SbkBufferExporterBufferProc);
+}
+
+static PyTypeObject *SbkBufferExporter_TypeF()
+{
+    static auto *type = createBufferExporterType();
+    return type;
+}
+
+} // extern "C"
+
+PyObject *Shiboken::Buffer::newObject(void *memory, const Layout &layout, Type type,
+                                      PyObject *owner)
+{
+    auto *exporter = PyObject_New(SbkBufferExporter, SbkBufferExporter_TypeF());
+    if (exporter == nullptr)
+        return nullptr;
+    exporter->memory = memory;
+    exporter->owner = owner;
+    Py_XINCREF(owner);
+    exporter->layout = layout;
+    exporter->type = type;
+    PyObject *result = PyMemoryView_FromObject(reinterpret_cast<PyObject *>(exporter));
+    Py_DECREF(exporter);
+    return result;
+}
@@ -15,6 +15,20 @@ namespace Shiboken::Buffer
         ReadWrite
     };
 
+    /**
+     * Describes a strided buffer of up to 3 dimensions (PEP 3118), for
+     * example the height, width and channels of an image. The format
+     * uses the struct module syntax.
+     */
+    struct Layout
+    {
+        int ndim = 1;
+        Py_ssize_t shape[3] = {0, 0, 0};
+        Py_ssize_t strides[3] = {0, 0, 0};
+        Py_ssize_t itemSize = 1;
+        const char *format = "B";
+    };
+
     /**
      * Creates a new Python buffer pointing to a contiguous memory block at
      * \p memory of size \p size.
@@ -27,6 +41,57 @@ namespace Shiboken::Buffer
      */
     LIBSHIBOKEN_API PyObject *newObject(const void *memory, Py_ssize_t size);
 
+    /**
+     * Creates a new Python buffer (memoryview) pointing to a strided memory
+     * block at \p memory described by \p layout. The buffer keeps
+     * \p owner alive.
+     */
+    LIBSHIBOKEN_API PyObject *newObject(void *memory, const Layout &layout, Type type,
+                                        PyObject *owner);
+
+    /**
+     * Fills \p view for a strided memory block at \p memory described by
+     * \p layout in the bf_getbuffer function of the type of \p obj. The
+     * request \p flags are checked against the layout. releaseInfo() must
+     * be called from the bf_releasebuffer function. An optional \p owner
+     * of the memory (for example, a capsule holding a shallow copy of an
+     * implicitly shared value) is kept alive until the buffer is released.
+     */
+    LIBSHIBOKEN_API int fillInfo(Py_buffer *view, PyObject *obj, void *memory,
+                                 const Layout &layout, Type type, int flags,
+                                 PyObject *owner = nullptr);
+
+    /**
+     * Releases the data allocated by fillInfo().
+     */
+    LIBSHIBOKEN_API void releaseInfo(Py_buffer *view);
+
+    /**
+     * Acquires a writable, C-contiguous buffer of \p pyObj (bytearray,
+     * memoryview, numpy array) for the duration of an operation writing
+     * into it, for example a read with the GIL released. If the object
+     * does not provide one, a Python error is set.
+     */
+    class LIBSHIBOKEN_API WritableBuffer
+    {
+    public:
+        WritableBuffer(const WritableBuffer &) = delete;
+        WritableBuffer &operator=(const WritableBuffer &) = delete;
+        WritableBuffer(WritableBuffer &&) = delete;
+        WritableBuffer &operator=(WritableBuffer &&) = delete;
+
+        explicit WritableBuffer(PyObject *pyObj);
+        ~WritableBuffer();
+
+        bool isValid() const { return m_valid; }
+        char *data() const { return static_cast<char *>(m_view.buf); }
+        Py_ssize_t size() const { return m_view.len; }
+
+    private:
+        Py_buffer m_view{};
+        bool m_valid = false;
+    };
+
     /**
      * Check if is ok to use \p pyObj as argument in all function under Shiboken::Buffer namespace.
      */
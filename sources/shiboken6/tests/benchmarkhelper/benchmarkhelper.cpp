@@ -0,0 +1,38 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "benchmarkhelper.h"
+
+#include <autodecref.h>
+
+static PyType_Slot Item_slots[] = {
+    {Py_tp_base, nullptr}, // inserted by introduceWrapperType
+    {Py_tp_dealloc, reinterpret_cast<void *>(&SbkDeallocWrapper)},
+    {0, nullptr}
+};
+
+static PyType_Spec Item_spec = {
+    "1:benchmark.Item",
+    sizeof(SbkObject),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    Item_slots
+};
+
+namespace BenchmarkHelper
+{
+
+PyTypeObject *createItemType(ObjectDestructor cppObjDtor)
+{
+    Py_Initialize();
+    Shiboken::init();
+
+    PyObject *module = PyModule_New("benchmark");
+    if (module == nullptr)
+        return nullptr;
+    Shiboken::AutoDecRef bases(PyTuple_Pack(1, SbkObject_TypeF()));
+    return Shiboken::ObjectType::introduceWrapperType(module, "Item", "Item*", &Item_spec,
+                                                      cppObjDtor, bases.object());
+}
+
+} // namespace BenchmarkHelper
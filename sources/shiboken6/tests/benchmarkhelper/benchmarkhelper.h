@@ -0,0 +1,22 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef BENCHMARKHELPER_H
+#define BENCHMARKHELPER_H
+
+#include <sbkpython.h>
+#include <basewrapper.h>
+
+// Fixture of the libshiboken benchmarks which use a minimal wrapper type
+// instead of libsample types, which would require loading the generated
+// module into the test executable.
+namespace BenchmarkHelper
+{
+
+// Initializes Python and libshiboken and creates the wrapper type
+// "benchmark.Item" whose C++ objects are deleted by cppObjDtor.
+PyTypeObject *createItemType(ObjectDestructor cppObjDtor = nullptr);
+
+} // namespace BenchmarkHelper
+
+#endif // BENCHMARKHELPER_H
@@ -0,0 +1,86 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "bindingmanagerbenchmark.h"
+
+#include <benchmarkhelper.h>
+
+#include <sbkpython.h>
+#include <basewrapper.h>
+#include <bindingmanager.h>
+
+#include <QtTest/QTest>
+
+#include <atomic>
+#include <thread>
+
+static constexpr qsizetype objectCount = 10000;
+static constexpr int lookupsPerThread = 200000;
+
+void BindingManagerBenchmark::initTestCase()
+{
+    m_type = BenchmarkHelper::createItemType();
+    QVERIFY(m_type != nullptr);
+
+    // The C++ objects are only used as keys, Python does not own them.
+    m_cppObjects.resize(objectCount);
+    m_wrappers.reserve(objectCount);
+    for (auto &cppObject : m_cppObjects) {
+        PyObject *wrapper = Shiboken::Object::newObject(m_type, &cppObject, false, true);
+        QVERIFY(wrapper != nullptr);
+        m_wrappers.append(wrapper);
+    }
+
+    // Lookups are done from threads without GIL as for QML.
+    PyEval_SaveThread();
+}
+
+void BindingManagerBenchmark::cleanupTestCase()
+{
+    PyGILState_Ensure();
+    for (auto *wrapper : std::as_const(m_wrappers))
+        Py_DECREF(wrapper);
+    m_wrappers.clear();
+}
+
+void BindingManagerBenchmark::retrieveWrapper_data()
+{
+    QTest::addColumn<int>("threadCount");
+
+    const int maxThreads = qMax(1, int(std::thread::hardware_concurrency()));
+    for (int threadCount = 1; threadCount < maxThreads; threadCount *= 2)
+        QTest::addRow("%d", threadCount) << threadCount;
+    QTest::addRow("%d", maxThreads) << maxThreads;
+}
+
+void BindingManagerBenchmark::retrieveWrapper()
+{
+    QFETCH(int, threadCount);
+
+    auto &bindingManager = Shiboken::BindingManager::instance();
+    std::atomic<int> failures = 0;
+
+    auto lookup = [this, &bindingManager, &failures](int offset) {
+        int localFailures = 0;
+        for (int i = 0; i < lookupsPerThread; ++i) {
+            const auto index = (offset + i) % objectCount;
+            auto *wrapper = bindingManager.retrieveWrapper(&m_cppObjects[index]);
+            if (reinterpret_cast<PyObject *>(wrapper) != m_wrappers.at(index))
+                ++localFailures;
+        }
+        failures += localFailures;
+    };
+
+    QBENCHMARK {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (int t = 0; t < threadCount; ++t)
+            threads.emplace_back(lookup, t * 997);
+        for (auto &thread : threads)
+            thread.join();
+    }
+
+    QCOMPARE(failures.load(), 0);
+}
+
+QTEST_APPLESS_MAIN(BindingManagerBenchmark)
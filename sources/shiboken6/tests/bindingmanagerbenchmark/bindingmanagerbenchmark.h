@@ -0,0 +1,32 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef BINDINGMANAGERBENCHMARK_H
+#define BINDINGMANAGERBENCHMARK_H
+
+#include <QtCore/QList>
+#include <QtCore/QObject>
+
+#include <vector>
+
+struct _object;
+struct _typeobject;
+
+// Measures the throughput of BindingManager::retrieveWrapper() when called
+// concurrently from several threads as it happens for QML.
+class BindingManagerBenchmark : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void retrieveWrapper_data();
+    void retrieveWrapper();
+
+private:
+    _typeobject *m_type = nullptr;
+    std::vector<qint64> m_cppObjects;
+    QList<_object *> m_wrappers;
+};
+
+#endif // BINDINGMANAGERBENCHMARK_H
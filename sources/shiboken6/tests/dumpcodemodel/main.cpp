@@ -3,11 +3,14 @@
 
 #include <abstractmetabuilder_p.h>
 #include <parser/codemodel.h>
+#include <parser/codemodelsnapshot.h>
+#include <clangparser/clangparser.h>
 #include <clangparser/compilersupport.h>
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QCommandLineOption>
 #include <QtCore/QCommandLineParser>
+#include <QtCore/QDataStream>
 #include <QtCore/QDateTime>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
@@ -43,6 +46,47 @@ static void formatDebugOutput(const FileModelItem &dom, bool verbose)
     std::cout << qPrintable(output) << '\n';
 }
 
+static QString debugOutput(const FileModelItem &dom)
+{
+    QString result;
+    QDebug debug(&result);
+    debug.setVerbosity(3);
+    debug << dom.get();
+    return result;
+}
+
+// Check that the code model survives a round trip through a snapshot
+static bool verifySnapshot(const FileModelItem &dom)
+{
+    QByteArray data;
+    {
+        QDataStream s(&data, QIODevice::WriteOnly);
+        CodeModelSnapshot::writeModel(s, dom);
+    }
+    CodeModel model;
+    QDataStream s(data);
+    const FileModelItem readDom = CodeModelSnapshot::readModel(s, &model);
+    if (!readDom) {
+        std::cerr << "Unable to read back the snapshot.\n";
+        return false;
+    }
+    if (debugOutput(dom) != debugOutput(readDom)) {
+        std::cerr << "The code model read from the snapshot differs.\n";
+        return false;
+    }
+    QByteArray rewrittenData;
+    {
+        QDataStream s(&rewrittenData, QIODevice::WriteOnly);
+        CodeModelSnapshot::writeModel(s, readDom);
+    }
+    if (rewrittenData != data) {
+        std::cerr << "The rewritten snapshot differs.\n";
+        return false;
+    }
+    std::cerr << "Snapshot verified (" << data.size() << " bytes).\n";
+    return true;
+}
+
 static const char *primitiveTypes[] = {
     "int", "unsigned", "short", "unsigned short", "long", "unsigned long",
     "float", "double"
@@ -218,13 +262,33 @@ int main(int argc, char **argv)
                                            languageLevelDescription(),
                                            u"level"_s);
     parser.addOption(languageLevelOption);
+
+    QCommandLineOption pchOption(u"precompiled-header"_s,
+                                 u"Header including dependencies to be precompiled"_s,
+                                 u"header"_s);
+    parser.addOption(pchOption);
+    QCommandLineOption pchDirectoryOption(u"precompiled-header-directory"_s,
+                                          u"Directory for the precompiled header"_s,
+                                          u"dir"_s);
+    parser.addOption(pchDirectoryOption);
+    QCommandLineOption writeSnapshotOption(u"write-snapshot"_s,
+                                           u"Write a snapshot of the code model"_s,
+                                           u"file"_s);
+    parser.addOption(writeSnapshotOption);
+    QCommandLineOption readSnapshotOption(u"read-snapshot"_s,
+                                          u"Read the code model from a snapshot instead of parsing"_s,
+                                          u"file"_s);
+    parser.addOption(readSnapshotOption);
+    QCommandLineOption verifySnapshotOption(u"verify-snapshot"_s,
+                                            u"Check that the code model survives a snapshot round trip"_s);
+    parser.addOption(verifySnapshotOption);
     parser.addPositionalArgument(u"argument"_s,
                                  u"C++ compiler argument"_s,
                                  u"argument(s)"_s);
 
     parser.process(app);
     const QStringList &positionalArguments = parser.positionalArguments();
-    if (positionalArguments.isEmpty())
+    if (positionalArguments.isEmpty() && !parser.isSet(readSnapshotOption))
         parser.showHelp(1);
 
     QByteArrayList arguments;
@@ -244,11 +308,42 @@ int main(int argc, char **argv)
 
     optJoinNamespaces = parser.isSet(joinNamespacesOption);
 
-    const FileModelItem dom = AbstractMetaBuilderPrivate::buildDom(arguments, true, level, 0);
-    if (!dom) {
-        QString message = u"Unable to parse "_s + positionalArguments.join(u' ');
-        std::cerr << qPrintable(message) << '\n';
-        return -2;
+    if (parser.isSet(pchOption)) {
+        const QString directory = parser.isSet(pchDirectoryOption)
+            ? parser.value(pchDirectoryOption) : clang::defaultPrecompiledHeaderDirectory();
+        clang::setPrecompiledHeader(parser.value(pchOption), directory);
+    }
+
+    CodeModel snapshotModel;
+    FileModelItem dom;
+    QStringList includedFiles;
+    if (parser.isSet(readSnapshotOption)) {
+        QString errorMessage;
+        dom = CodeModelSnapshot::load(parser.value(readSnapshotOption), {}, &snapshotModel,
+                                      &includedFiles, &errorMessage);
+        if (!dom) {
+            std::cerr << qPrintable(errorMessage) << '\n';
+            return -2;
+        }
+    } else {
+        dom = AbstractMetaBuilderPrivate::buildDom(arguments, true, level, 0, &includedFiles);
+        if (!dom) {
+            QString message = u"Unable to parse "_s + positionalArguments.join(u' ');
+            std::cerr << qPrintable(message) << '\n';
+            return -2;
+        }
+    }
+
+    if (parser.isSet(verifySnapshotOption) && !verifySnapshot(dom))
+        return -3;
+
+    if (parser.isSet(writeSnapshotOption)) {
+        QString errorMessage;
+        if (!CodeModelSnapshot::save(parser.value(writeSnapshotOption), "dumpcodemodel"_ba,
+                                     includedFiles, dom, &errorMessage)) {
+            std::cerr << qPrintable(errorMessage) << '\n';
+            return -2;
+        }
     }
 
     if (parser.isSet(debugOption))
@@ -0,0 +1,149 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+"""
+Measure the parse time saved by a precompiled header
+----------------------------------------------------
+
+Usage: python3 pchtiming.py --dumpcodemodel <path> [options]
+
+Runs dumpcodemodel on a set of module headers sharing the same dependencies,
+once parsing everything and once reusing a precompiled header of the
+dependencies, similar to shiboken's --precompiled-header option used for
+several modules.
+
+A synthetic header set is generated by default:
+
+    python3 pchtiming.py --dumpcodemodel build/dumpcodemodel --dependencies 200
+
+Existing headers can be measured by passing them with the include statements
+of their shared dependencies, for example libsample:
+
+    python3 pchtiming.py --dumpcodemodel build/dumpcodemodel \\
+        --headers sources/shiboken6/tests/libsample/*.h \\
+        --shared list map memory string utility vector \\
+        -- -Isources/shiboken6/tests/libsample
+"""
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+
+from pathlib import Path
+from timeit import default_timer as timer
+
+DEPENDENCY_CLASS = """
+class Dependency{index}_{cls} : public Base
+{{
+public:
+    Dependency{index}_{cls}();
+    explicit Dependency{index}_{cls}(const std::string &name, int value = 0);
+    ~Dependency{index}_{cls}() override;
+
+    std::vector<std::string> names() const;
+    std::map<std::string, int> values() const;
+    void setValue(const std::string &key, int value);
+    template <class T> T convert(const T &v) const {{ return v; }}
+    int value() const override;
+
+private:
+    std::unordered_map<int, std::shared_ptr<Base>> m_children;
+}};
+"""
+
+MODULE_HEADER = """#include "dependencies.h"
+
+class Module{index}
+{{
+public:
+    void process(const Dependency0_0 &d);
+    Dependency{index}_0 create() const;
+}};
+"""
+
+
+def write_synthetic_headers(directory, dependencies, classes, modules):
+    base = "class Base { public: virtual ~Base(); virtual int value() const = 0; };\n"
+    includes = "#include <map>\n#include <memory>\n#include <string>\n" \
+               "#include <unordered_map>\n#include <vector>\n"
+    dependency_includes = []
+    for index in range(dependencies):
+        name = f"dependency{index}.h"
+        body = "".join(DEPENDENCY_CLASS.format(index=index, cls=cls)
+                       for cls in range(classes))
+        guard = f"DEPENDENCY{index}_H"
+        text = f"#ifndef {guard}\n#define {guard}\n{includes}#include \"base.h\"\n{body}#endif\n"
+        (directory / name).write_text(text)
+        dependency_includes.append(f'#include "{name}"\n')
+    (directory / "base.h").write_text(f"#ifndef BASE_H\n#define BASE_H\n{base}#endif\n")
+    (directory / "dependencies.h").write_text("#pragma once\n" + "".join(dependency_includes))
+
+    headers = []
+    for index in range(modules):
+        header = directory / f"module{index}.h"
+        header.write_text(MODULE_HEADER.format(index=index % dependencies))
+        headers.append(header)
+    return directory / "dependencies.h", headers
+
+
+def run(dumpcodemodel, header, clang_args, pch_args):
+    cmd = [dumpcodemodel, *pch_args, "--", *clang_args, os.fspath(header)]
+    start = timer()
+    subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+    return timer() - start
+
+
+def measure(dumpcodemodel, headers, clang_args, pch_args, repeats):
+    totals = []
+    for _ in range(repeats):
+        totals.append(sum(run(dumpcodemodel, h, clang_args, pch_args) for h in headers))
+    return statistics.median(totals)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--dumpcodemodel", required=True, help="Path to dumpcodemodel")
+    parser.add_argument("--repeats", type=int, default=3, help="Number of runs")
+    parser.add_argument("--dependencies", type=int, default=100,
+                        help="Number of synthetic dependency headers")
+    parser.add_argument("--classes", type=int, default=20,
+                        help="Number of classes per synthetic dependency header")
+    parser.add_argument("--modules", type=int, default=10,
+                        help="Number of synthetic module headers")
+    parser.add_argument("--headers", nargs="+", help="Existing module headers")
+    parser.add_argument("--shared", nargs="+", default=[],
+                        help="Shared dependencies of --headers (<include> names)")
+    parser.add_argument("clang_args", nargs="*", help="Arguments passed to clang")
+    options = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        directory = Path(temp_dir)
+        if options.headers:
+            headers = [Path(h).resolve() for h in options.headers]
+            shared_header = directory / "shared.h"
+            shared_header.write_text("".join(f"#include <{i}>\n" for i in options.shared))
+            clang_args = options.clang_args
+        else:
+            shared_header, headers = write_synthetic_headers(directory, options.dependencies,
+                                                             options.classes, options.modules)
+            clang_args = [f"-I{directory}", *options.clang_args]
+
+        pch_args = ["--precompiled-header", os.fspath(shared_header),
+                    "--precompiled-header-directory", os.fspath(directory / "pch")]
+        print(f"{len(headers)} headers, {options.repeats} repeats")
+        plain = measure(options.dumpcodemodel, headers, clang_args, [], options.repeats)
+        print(f"  without precompiled header: {plain:.3f}s")
+        start = timer()
+        run(options.dumpcodemodel, headers[0], clang_args, pch_args)  # creates the PCH
+        print(f"  creating precompiled header and first parse: {timer() - start:.3f}s")
+        pch = measure(options.dumpcodemodel, headers, clang_args, pch_args, options.repeats)
+        print(f"  with precompiled header: {pch:.3f}s ({100 * (plain - pch) / plain:.1f}% saved)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,92 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "generatorcachetest.h"
+#include "generatorcache.h"
+
+#include <optionsparser.h>
+
+#include <QtTest/QTest>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+
+using namespace Qt::StringLiterals;
+
+static bool writeFile(const QString &fileName, const QByteArray &contents)
+{
+    QFile file(fileName);
+    return file.open(QIODevice::WriteOnly) && file.write(contents) == contents.size();
+}
+
+static QByteArray optionsHash(const QStringList &argv)
+{
+    Options options;
+    options.setOptions(argv);
+    return GeneratorCache::optionsHash(options);
+}
+
+static bool isUpToDate(const QString &cacheFile, const QByteArray &optionsHash)
+{
+    GeneratorCache cache(cacheFile);
+    return cache.isUpToDate(optionsHash);
+}
+
+void GeneratorCacheTest::testCache()
+{
+    QTemporaryDir tempDir;
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+    const QString header = tempDir.filePath(u"global.h"_s);
+    const QString typeSystem = tempDir.filePath(u"typesystem.xml"_s);
+    const QString output = tempDir.filePath(u"module_wrapper.cpp"_s);
+    const QString cacheFile = tempDir.filePath(u"module.cache"_s);
+    QVERIFY(writeFile(header, "class Foo {};\n"));
+    QVERIFY(writeFile(typeSystem, "<typesystem package=\"module\"/>\n"));
+    const QByteArray outputContents = "// Foo wrapper\n";
+    QVERIFY(writeFile(output, outputContents));
+
+    const QStringList argv{u"--enable-pyside-extensions"_s, u"--output-directory=out"_s,
+                           header, typeSystem};
+    const QByteArray hash = optionsHash(argv);
+    QCOMPARE(optionsHash(argv), hash);
+
+    QVERIFY(!isUpToDate(cacheFile, hash)); // No cache file yet
+    {
+        GeneratorCache cache(cacheFile);
+        QVERIFY(!cache.isUpToDate(hash));
+        const FileOut::Records outputs{
+            {output, QCryptographicHash::hash(outputContents, QCryptographicHash::Sha1),
+             FileOut::Success}};
+        QString errorMessage;
+        QVERIFY2(cache.write(hash, {typeSystem, header}, outputs, &errorMessage),
+                 qPrintable(errorMessage));
+    }
+
+    // Hit
+    QVERIFY(isUpToDate(cacheFile, hash));
+
+    // Touching a header without modifying it is still a hit
+    {
+        QFile file(header);
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        QVERIFY(file.setFileTime(QDateTime::currentDateTime().addSecs(60),
+                                 QFileDevice::FileModificationTime));
+    }
+    QVERIFY(isUpToDate(cacheFile, hash));
+
+    // Miss after changing an option
+    QStringList changedArgv = argv;
+    changedArgv.replace(1, u"--output-directory=out2"_s);
+    const QByteArray changedHash = optionsHash(changedArgv);
+    QVERIFY(changedHash != hash);
+    QVERIFY(!isUpToDate(cacheFile, changedHash));
+    QVERIFY(isUpToDate(cacheFile, hash));
+
+    // Miss after modifying a header
+    QVERIFY(writeFile(header, "class Foo { int x; };\n"));
+    QVERIFY(!isUpToDate(cacheFile, hash));
+}
+
+QTEST_GUILESS_MAIN(GeneratorCacheTest)
@@ -0,0 +1,17 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef GENERATORCACHETEST_H
+#define GENERATORCACHETEST_H
+
+#include <QtCore/QObject>
+
+class GeneratorCacheTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testCache();
+};
+
+#endif // GENERATORCACHETEST_H
@@ -0,0 +1,69 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "keepreferencebenchmark.h"
+
+#include <benchmarkhelper.h>
+
+#include <sbkpython.h>
+#include <basewrapper.h>
+
+#include <QtTest/QTest>
+
+static constexpr int callCount = 100000;
+static const char keyName[] = "setModel(ObjectModel*)1";
+
+void KeepReferenceBenchmark::initTestCase()
+{
+    m_type = BenchmarkHelper::createItemType();
+    QVERIFY(m_type != nullptr);
+    // Python does not own the C++ object.
+    m_wrapper = Shiboken::Object::newObject(m_type, &m_cppObject, false, true);
+    QVERIFY(m_wrapper != nullptr);
+    m_referred = PyList_New(0);
+    QVERIFY(m_referred != nullptr);
+}
+
+void KeepReferenceBenchmark::cleanupTestCase()
+{
+    Py_XDECREF(m_wrapper);
+    Py_XDECREF(m_referred);
+}
+
+void KeepReferenceBenchmark::keepReference_data()
+{
+    QTest::addColumn<bool>("interned");
+
+    QTest::addRow("string key") << false;
+    QTest::addRow("interned key") << true;
+}
+
+// Repeatedly set the same reference as a setter called in a loop does.
+void KeepReferenceBenchmark::keepReference()
+{
+    QFETCH(bool, interned);
+
+    auto *self = reinterpret_cast<SbkObject *>(m_wrapper);
+    const auto refCount = Py_REFCNT(m_referred);
+
+    if (interned) {
+        QBENCHMARK {
+            for (int i = 0; i < callCount; ++i) {
+                static const auto key = Shiboken::Object::referenceKey(keyName);
+                Shiboken::Object::keepReference(self, key, m_referred);
+            }
+        }
+    } else {
+        QBENCHMARK {
+            for (int i = 0; i < callCount; ++i)
+                Shiboken::Object::keepReference(self, keyName, m_referred);
+        }
+    }
+
+    // The reference is replaced, not accumulated.
+    QCOMPARE(Py_REFCNT(m_referred), refCount + 1);
+    Shiboken::Object::removeReference(self, keyName, m_referred);
+    QCOMPARE(Py_REFCNT(m_referred), refCount);
+}
+
+QTEST_APPLESS_MAIN(KeepReferenceBenchmark)
@@ -0,0 +1,31 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef KEEPREFERENCEBENCHMARK_H
+#define KEEPREFERENCEBENCHMARK_H
+
+#include <QtCore/QObject>
+
+struct _object;
+struct _typeobject;
+
+// Measures Shiboken::Object::keepReference() as called by generated setters
+// and reference count modifications, comparing string keys with the
+// interned keys used by the generated code.
+class KeepReferenceBenchmark : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void keepReference_data();
+    void keepReference();
+
+private:
+    _typeobject *m_type = nullptr;
+    _object *m_wrapper = nullptr;
+    _object *m_referred = nullptr;
+    qint64 m_cppObject = 0;
+};
+
+#endif // KEEPREFERENCEBENCHMARK_H
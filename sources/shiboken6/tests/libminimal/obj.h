@@ -16,6 +16,16 @@ public:
 
     int objId() const { return m_objId; }
     void setObjId(int objId) { m_objId = objId; }
+    int addToObjId(int a, int b = 0) const { return m_objId + a + b; }
+
+    // Overloads distinguished by the argument types
+    int argumentKind(int, int) const { return 0; }
+    int argumentKind(double, double) const { return 1; }
+    int argumentKind(Obj *, int) const { return 2; }
+
+    // Overloads distinguished by the number protocol of the argument type
+    int numberOrObject(int) const { return 0; }
+    int numberOrObject(Obj *) const { return 1; }
 
     virtual bool virtualMethod(int val);
     bool callVirtualMethod(int val) { return virtualMethod(val); }
@@ -39,6 +39,53 @@ class ObjTest(unittest.TestCase):
         obj = Obj(objId)
         self.assertEqual(obj.objId(), objId)
 
+    def testDefaultArguments(self):
+        obj = Obj(1)
+        self.assertEqual(obj.addToObjId(2), 3)
+        self.assertEqual(obj.addToObjId(2, 3), 6)
+        self.assertEqual(obj.addToObjId(2, b=3), 6)
+        self.assertEqual(obj.addToObjId(a=2, b=3), 6)
+        self.assertRaises(TypeError, obj.addToObjId)
+        self.assertRaises(TypeError, obj.addToObjId, 1, 2, 3)
+        self.assertRaises(TypeError, obj.addToObjId, 1, c=3)
+
+    def testOverloadsByArgumentTypes(self):
+        # Repeated calls hit the overload cache, the varying argument types
+        # exceed its size.
+        obj = Obj(0)
+        for _ in range(3):
+            self.assertEqual(obj.argumentKind(1, 2), 0)
+            self.assertEqual(obj.argumentKind(1.5, 2.5), 1)
+            self.assertEqual(obj.argumentKind(obj, 2), 2)
+            self.assertEqual(obj.argumentKind(None, 2), 2)
+            self.assertEqual(obj.argumentKind(ExtObj(1), 2), 2)
+            self.assertEqual(obj.argumentKind(True, False), 0)
+            self.assertRaises(TypeError, obj.argumentKind, "1", 2)
+            self.assertRaises(TypeError, obj.argumentKind, obj, "2")
+
+    def testOverloadsWithModifiedTypes(self):
+        obj = Obj(0)
+
+        class NumberObj(Obj):
+            pass
+
+        number = NumberObj(1)
+        for _ in range(2):
+            self.assertEqual(obj.numberOrObject(number), 1)
+        # Adding the number protocol invalidates the overload caches, the int
+        # overload is checked first.
+        NumberObj.__index__ = lambda self: 42
+        for _ in range(2):
+            self.assertEqual(obj.numberOrObject(number), 0)
+        del NumberObj.__index__
+        self.assertEqual(obj.numberOrObject(number), 1)
+
+        class Plain:
+            pass
+
+        self.assertRaises(TypeError, obj.numberOrObject, Plain())
+        self.assertEqual(obj.numberOrObject(5), 0)
+
     def testNormalMethodFromExtendedClass(self):
         objId = 123
         obj = ExtObj(objId)
@@ -0,0 +1,103 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Stress test running bindings from several threads concurrently.
+
+This exercises the locking of the libshiboken registries on free-threaded
+Python builds (PEP 703). The sample module is generated with
+--free-threading; the test is skipped when the GIL is enabled.'''
+
+import os
+import sys
+import threading
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+import sample
+from sample import ObjectModel, ObjectType, ObjectView, Point, Str
+
+
+THREAD_COUNT = 8
+ITERATIONS = 2000
+
+GIL_ENABLED = getattr(sys, "_is_gil_enabled", lambda: True)()
+
+
+def run_concurrently(function):
+    '''Runs function(index) in THREAD_COUNT threads started together and
+       returns the exceptions raised.'''
+    barrier = threading.Barrier(THREAD_COUNT)
+    errors = []
+
+    def worker(index):
+        barrier.wait()
+        try:
+            function(index)
+        except Exception as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(THREAD_COUNT)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    return errors
+
+
+@unittest.skipIf(GIL_ENABLED, "Requires a free-threaded Python build with the GIL disabled")
+class FreeThreadingTest(unittest.TestCase):
+
+    def testParentChild(self):
+        def work(index):
+            for _ in range(ITERATIONS):
+                parent = ObjectType()
+                parent.setObjectName(Str(f"parent{index}"))
+                children = [ObjectType(parent) for _ in range(4)]
+                self.assertEqual(len(parent.children()), len(children))
+                children[0].setParent(None)
+                del parent
+                self.assertEqual(str(children[0].objectName()), "")
+
+        self.assertEqual(run_concurrently(work), [])
+
+    def testConverters(self):
+        def work(index):
+            for i in range(ITERATIONS):
+                point = Point(i, index) + Point(1, 1)
+                self.assertEqual(point, Point(i + 1, index + 1))
+                self.assertEqual(str(Str(f"{index}:{i}")), f"{index}:{i}")
+
+        self.assertEqual(run_concurrently(work), [])
+
+    def testLazyTypeAccess(self):
+        names = [name for name in dir(sample) if not name.startswith("_")]
+
+        def work(index):
+            for _ in range(ITERATIONS // 100):
+                for name in names:
+                    self.assertIsNotNone(getattr(sample, name))
+
+        self.assertEqual(run_concurrently(work), [])
+
+    def testKeepReference(self):
+        shared_model = ObjectModel()
+
+        def work(index):
+            view = ObjectView()
+            for i in range(ITERATIONS):
+                model = shared_model if i % 2 else ObjectModel()
+                view.setModel(model)
+                del model
+                self.assertIsNotNone(view.model())
+            view.setModel(None)
+
+        self.assertEqual(run_concurrently(work), [])
+
+
+if __name__ == '__main__':
+    unittest.main()
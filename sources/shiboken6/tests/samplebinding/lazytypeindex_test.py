@@ -0,0 +1,48 @@
+#!/usr/bin/env python
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+"""PYSIDE-2404: Test the lazy creation of types via the generated type
+   creation index of the module."""
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+import sample
+
+
+class LazyTypeIndexTest(unittest.TestCase):
+
+    def testDir(self):
+        names = dir(sample)
+        for name in ("ObjectType", "Point", "SampleNamespace", "Derived"):
+            self.assertIn(name, names)
+        self.assertEqual(len(names), len(set(names)))
+
+    def testTopLevelType(self):
+        point_type = sample.Point
+        self.assertIs(sample.Point, point_type)
+        self.assertIs(getattr(sample, "Point"), point_type)
+        self.assertIn("Point", sample.__dict__)
+
+    def testNestedTypes(self):
+        inner_type = sample.SampleNamespace.SomeClass.SomeInnerClass
+        self.assertIs(sample.SampleNamespace.SomeClass.SomeInnerClass, inner_type)
+        self.assertIsNotNone(sample.Derived.SomeInnerClass())
+
+    def testUnknownAttribute(self):
+        with self.assertRaises(AttributeError):
+            getattr(sample, "DoesNotExist")
+        with self.assertRaises(AttributeError):
+            getattr(sample, "Poin")
+
+
+if __name__ == '__main__':
+    unittest.main()
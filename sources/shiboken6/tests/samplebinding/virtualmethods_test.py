@@ -116,6 +116,18 @@ class VirtualMethodsTest(unittest.TestCase):
         self.assertTrue(eevd.grand_grand_daughter_name_called)
         self.assertEqual(eevd.name().prepend(self.prefix_from_codeinjection), name)
 
+    def testOverrideAddedToClassLater(self):
+        '''Test that overrides assigned to or deleted from a class are seen by
+           new instances after the virtual method was called from C++.'''
+        class LateVirtualMethods(VirtualMethods):
+            pass
+
+        self.assertEqual(LateVirtualMethods().callSum0(2, 3, 4), 9)
+        LateVirtualMethods.sum0 = lambda self, a0, a1, a2: a0 * a1 * a2
+        self.assertEqual(LateVirtualMethods().callSum0(2, 3, 4), 24)
+        del LateVirtualMethods.sum0
+        self.assertEqual(LateVirtualMethods().callSum0(2, 3, 4), 9)
+
     def testStringView(self):
         virtual_methods = VirtualMethods()
         self.assertEqual(virtual_methods.stringViewLength('bla'), 3)
@@ -0,0 +1,100 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "wrappercreationbenchmark.h"
+
+#include <benchmarkhelper.h>
+
+#include <sbkpython.h>
+#include <basewrapper.h>
+#include <bindingmanager.h>
+
+#include <QtTest/QTest>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Count the C++ heap allocations (Python allocations are not included).
+static std::atomic<qint64> allocationCount = 0;
+
+void *operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void *p = std::malloc(size != 0 ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+// The C++ objects are owned by the benchmark.
+static void deleteItem(void *)
+{
+}
+
+void WrapperCreationBenchmark::initTestCase()
+{
+    m_type = BenchmarkHelper::createItemType(deleteItem);
+    QVERIFY(m_type != nullptr);
+}
+
+void WrapperCreationBenchmark::createChildren_data()
+{
+    QTest::addColumn<int>("childCount");
+
+    QTest::addRow("1000") << 1000;
+    QTest::addRow("100000") << 100000;
+}
+
+void WrapperCreationBenchmark::createChildren()
+{
+    QFETCH(int, childCount);
+
+    std::vector<qint64> cppObjects(childCount + 1);
+    qint64 allocations = 0;
+    qint64 wrapperCount = 0;
+
+    QBENCHMARK {
+        const qint64 allocationsBefore = allocationCount;
+        PyObject *parent = Shiboken::Object::newObject(m_type, &cppObjects.back(), true, true);
+        for (int i = 0; i < childCount; ++i) {
+            PyObject *child = Shiboken::Object::newObject(m_type, &cppObjects[i], true, true);
+            Shiboken::Object::setParent(parent, child);
+            Py_DECREF(child);
+        }
+        allocations += allocationCount - allocationsBefore;
+        wrapperCount += childCount + 1;
+
+        Py_DECREF(parent); // Deletes the children
+    }
+
+    QVERIFY(Shiboken::BindingManager::instance().retrieveWrapper(&cppObjects.front()) == nullptr);
+    qInfo("%.2f C++ heap allocations per wrapper", double(allocations) / double(wrapperCount));
+}
+
+QTEST_APPLESS_MAIN(WrapperCreationBenchmark)
@@ -0,0 +1,26 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef WRAPPERCREATIONBENCHMARK_H
+#define WRAPPERCREATIONBENCHMARK_H
+
+#include <QtCore/QObject>
+
+struct _typeobject;
+
+// Measures the creation of wrappers which are children of a parent wrapper
+// as it happens for item models and reports the C++ heap allocations per
+// wrapper.
+class WrapperCreationBenchmark : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void createChildren_data();
+    void createChildren();
+
+private:
+    _typeobject *m_type = nullptr;
+};
+
+#endif // WRAPPERCREATIONBENCHMARK_H